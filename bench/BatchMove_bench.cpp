@@ -0,0 +1,43 @@
+#include "BatchMove.hpp"
+#include "BoardCorpus.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace {
+
+constexpr Core::SimdLevel LEVELS[] = {Core::SimdLevel::Scalar,
+                                      Core::SimdLevel::SSE41,
+                                      Core::SimdLevel::AVX2};
+constexpr const char *LEVEL_NAMES[] = {"Scalar", "SSE4.1", "AVX2"};
+
+// Whole recorded corpus, one direction per batch; items = boards moved
+void BM_BatchMove(benchmark::State &state) {
+  const Core::SimdLevel level = LEVELS[state.range(0)];
+  if (!Core::BatchMove::isSupported(level)) {
+    state.SkipWithError("SIMD level not supported on this CPU");
+    return;
+  }
+
+  std::vector<std::uint64_t> boards;
+  for (Core::Bitboard board : Bench::corpusBoards())
+    boards.push_back(board.raw());
+  std::vector<std::uint64_t> outBoards(boards.size());
+  std::vector<std::uint32_t> scores(boards.size());
+  std::vector<std::uint8_t> moved(boards.size());
+  const Core::BatchMoveOutput out{outBoards.data(), scores.data(),
+                                  moved.data()};
+  int dir = 0;
+
+  for (auto _ : state) {
+    Core::BatchMove::apply(level, boards.data(), boards.size(),
+                           static_cast<Core::Direction>(dir++ & 3), out);
+    benchmark::DoNotOptimize(outBoards.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(boards.size()));
+  state.SetLabel(LEVEL_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_BatchMove)->DenseRange(0, 2);
+
+} // namespace
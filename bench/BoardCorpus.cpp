@@ -0,0 +1,57 @@
+#include "BoardCorpus.hpp"
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#ifndef TILETWISTER_BENCH_DATA_DIR
+#define TILETWISTER_BENCH_DATA_DIR "bench/data"
+#endif
+
+namespace Bench {
+
+namespace {
+
+std::vector<Core::Bitboard> loadBoards() {
+  const std::string path = std::string(TILETWISTER_BENCH_DATA_DIR) + "/boards.txt";
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("Cannot open board corpus: " + path);
+  }
+
+  std::vector<Core::Bitboard> boards;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+    std::size_t parsed = 0;
+    const std::uint64_t raw = std::stoull(line, &parsed, 16);
+    if (parsed != 16) {
+      throw std::runtime_error("Malformed board in " + path + ": " + line);
+    }
+    boards.emplace_back(raw);
+  }
+  if (boards.empty()) {
+    throw std::runtime_error("Board corpus is empty: " + path);
+  }
+  return boards;
+}
+
+} // namespace
+
+const std::vector<Core::Bitboard> &corpusBoards() {
+  static const std::vector<Core::Bitboard> boards = loadBoards();
+  return boards;
+}
+
+const std::vector<Core::Grid> &corpusGrids() {
+  static const std::vector<Core::Grid> grids = [] {
+    std::vector<Core::Grid> out(corpusBoards().size());
+    for (std::size_t i = 0; i < out.size(); ++i)
+      corpusBoards()[i].toGrid(out[i]);
+    return out;
+  }();
+  return grids;
+}
+
+} // namespace Bench
@@ -0,0 +1,21 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "Grid.hpp"
+#include <vector>
+
+namespace Bench {
+
+/**
+ * @brief Recorded mid-game boards from bench/data/boards.txt.
+ *
+ * Loaded once on first use. Benchmarks cycle through the corpus so that
+ * branch patterns match real play instead of a single board.
+ *
+ * @throws std::runtime_error if the data file is missing or malformed.
+ */
+const std::vector<Core::Bitboard> &corpusBoards();
+
+// Same boards as Grid values
+const std::vector<Core::Grid> &corpusGrids();
+
+} // namespace Bench
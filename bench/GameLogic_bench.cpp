@@ -0,0 +1,135 @@
+#include "BoardCorpus.hpp"
+#include "GameLogic.hpp"
+#include "Grid.hpp"
+#include <benchmark/benchmark.h>
+#include <bit>
+
+namespace {
+
+constexpr Core::Direction DIRECTIONS[] = {
+    Core::Direction::Up, Core::Direction::Down, Core::Direction::Left,
+    Core::Direction::Right};
+constexpr const char *DIRECTION_NAMES[] = {"Up", "Down", "Left", "Right"};
+
+// Cycles through the recorded corpus
+class GridCursor {
+public:
+  GridCursor() : m_grids(Bench::corpusGrids()) {}
+  const Core::Grid &next() {
+    const Core::Grid &grid = m_grids[m_index];
+    if (++m_index == m_grids.size())
+      m_index = 0;
+    return grid;
+  }
+
+private:
+  const std::vector<Core::Grid> &m_grids;
+  std::size_t m_index = 0;
+};
+
+// Event mode: what Game::handleInputPlaying runs for animations
+void BM_MoveWithEvents(benchmark::State &state) {
+  const Core::Direction dir = DIRECTIONS[state.range(0)];
+  Core::GameLogic logic;
+  Core::GameLogic::MoveEventBuffer events;
+  GridCursor boards;
+
+  for (auto _ : state) {
+    Core::Grid grid = boards.next();
+    auto result = logic.move(grid, dir, events);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(events);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(DIRECTION_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_MoveWithEvents)->DenseRange(0, 3);
+
+// Fast mode: board and score only (simulation / AI lookahead)
+void BM_MoveFast(benchmark::State &state) {
+  const Core::Direction dir = DIRECTIONS[state.range(0)];
+  Core::GameLogic logic;
+  GridCursor boards;
+
+  for (auto _ : state) {
+    Core::Grid grid = boards.next();
+    auto result = logic.moveFast(grid, dir);
+    benchmark::DoNotOptimize(result);
+    benchmark::DoNotOptimize(grid);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(DIRECTION_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_MoveFast)->DenseRange(0, 3);
+
+// Transform strategy: transpose/reverse passes + slideAndMergeRow per row
+void BM_MoveReference(benchmark::State &state) {
+  const Core::Direction dir = DIRECTIONS[state.range(0)];
+  Core::GameLogic logic;
+  GridCursor boards;
+
+  for (auto _ : state) {
+    Core::Grid grid = boards.next();
+    auto result = logic.moveReference(grid, dir);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(DIRECTION_NAMES[state.range(0)]);
+}
+BENCHMARK(BM_MoveReference)->DenseRange(0, 3);
+
+void BM_LegalMoves(benchmark::State &state) {
+  GridCursor boards;
+  for (auto _ : state) {
+    auto mask = Core::GameLogic::legalMoves(boards.next());
+    benchmark::DoNotOptimize(mask);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LegalMoves);
+
+void BM_IsGameOver(benchmark::State &state) {
+  Core::GameLogic logic;
+  GridCursor boards;
+  for (auto _ : state) {
+    bool over = logic.isGameOver(boards.next());
+    benchmark::DoNotOptimize(over);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsGameOver);
+
+// Complete games from two starting tiles with uniformly random legal moves.
+// Items = moves, so items_per_second is end-to-end moves/sec.
+void BM_RandomGame(benchmark::State &state) {
+  Core::GameLogic logic;
+  Core::Rng rng(2048);
+  int64_t moves = 0;
+
+  for (auto _ : state) {
+    Core::Grid grid;
+    grid.spawnRandomTile(rng);
+    grid.spawnRandomTile(rng);
+    int score = 0;
+
+    while (const std::uint8_t mask = Core::GameLogic::legalMoves(grid)) {
+      // Pick the k-th set bit of the legal mask
+      auto k = rng.nextBelow(static_cast<std::uint32_t>(std::popcount(mask)));
+      std::uint8_t bits = mask;
+      for (; k > 0; --k)
+        bits &= static_cast<std::uint8_t>(bits - 1);
+      const auto dir = static_cast<Core::Direction>(std::countr_zero(bits));
+
+      score += logic.moveFast(grid, dir).score;
+      grid.spawnRandomTile(rng);
+      ++moves;
+    }
+    benchmark::DoNotOptimize(score);
+  }
+  state.SetItemsProcessed(moves);
+  state.counters["moves/game"] = benchmark::Counter(
+      static_cast<double>(moves), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_RandomGame);
+
+} // namespace
@@ -0,0 +1,42 @@
+#include "BoardCorpus.hpp"
+#include "Grid.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+// Spawn into recorded boards (varying number of empty cells)
+void BM_SpawnRandomTile(benchmark::State &state) {
+  const auto &grids = Bench::corpusGrids();
+  Core::Rng rng(7);
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    Core::Grid grid = grids[i];
+    if (++i == grids.size())
+      i = 0;
+    auto pos = grid.spawnRandomTile(rng);
+    benchmark::DoNotOptimize(pos);
+    benchmark::DoNotOptimize(grid);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SpawnRandomTile);
+
+// Board copy, as done by search and by every "try a move" caller
+void BM_GridCopy(benchmark::State &state) {
+  const auto &grids = Bench::corpusGrids();
+  std::size_t i = 0;
+
+  for (auto _ : state) {
+    Core::Grid copy = grids[i];
+    if (++i == grids.size())
+      i = 0;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(sizeof(Core::Grid)));
+}
+BENCHMARK(BM_GridCopy);
+
+} // namespace
@@ -0,0 +1,125 @@
+#include "BoardCorpus.hpp"
+#include "NTuple.hpp"
+#include "QuantizedNTuple.hpp"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+namespace {
+
+// Standard 256 MB network: TILETWISTER_NTUPLE_WEIGHTS if set (e.g. output
+// of TileTwister_Train), else a short training run
+const AI::NTupleNetwork &benchNetwork() {
+  static const auto network = []() -> std::unique_ptr<AI::NTupleNetwork> {
+    if (const char *path = std::getenv("TILETWISTER_NTUPLE_WEIGHTS"))
+      return AI::NTupleNetwork::load(path);
+    auto trained = std::make_unique<AI::NTupleNetwork>(
+        AI::NTupleNetwork::standardTuples());
+    for (std::uint64_t seed = 1; seed <= 2000; ++seed)
+      AI::playTrainingGame(*trained, 0.1f, seed);
+    return trained;
+  }();
+  return *network;
+}
+
+// Cycles through the recorded corpus
+class BoardCursor {
+public:
+  BoardCursor() : m_boards(Bench::corpusBoards()) {}
+  Core::Bitboard next() {
+    const Core::Bitboard board = m_boards[m_index];
+    if (++m_index == m_boards.size())
+      m_index = 0;
+    return board;
+  }
+
+private:
+  const std::vector<Core::Bitboard> &m_boards;
+  std::size_t m_index = 0;
+};
+
+// Float reference
+void BM_NTupleEvalFloat(benchmark::State &state) {
+  const AI::NTupleNetwork &network = benchNetwork();
+  BoardCursor boards;
+  for (auto _ : state) {
+    float value = network.evaluate(boards.next());
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["MB"] = static_cast<double>(network.weightCount() * 4) / (1 << 20);
+}
+BENCHMARK(BM_NTupleEvalFloat);
+
+constexpr AI::WeightPrecision PRECISIONS[] = {AI::WeightPrecision::Int16,
+                                              AI::WeightPrecision::Int8};
+constexpr Core::SimdLevel KERNELS[] = {Core::SimdLevel::Scalar,
+                                       Core::SimdLevel::AVX2};
+
+// Args: precision (0 = int16, 1 = int8), kernel (0 = scalar, 1 = AVX2).
+// Besides evals/sec, reports the error against the float network over the
+// corpus: mean absolute error relative to the mean |value|, and how often
+// the greedy afterstate move changes.
+void BM_NTupleEvalQuantized(benchmark::State &state) {
+  const AI::WeightPrecision precision = PRECISIONS[state.range(0)];
+  const Core::SimdLevel level = KERNELS[state.range(1)];
+  if (!Core::BatchMove::isSupported(level)) {
+    state.SkipWithError("SIMD level not supported on this CPU");
+    return;
+  }
+  const AI::NTupleNetwork &network = benchNetwork();
+  const AI::QuantizedNTupleNetwork quantized(network, precision);
+
+  double absError = 0.0;
+  double absValue = 0.0;
+  int moveChanges = 0;
+  int decisions = 0;
+  for (Core::Bitboard board : Bench::corpusBoards()) {
+    const float exact = network.evaluate(board);
+    absError += std::fabs(quantized.evaluate(level, board) - exact);
+    absValue += std::fabs(exact);
+
+    int bestExact = -1;
+    int bestQuantized = -1;
+    float valueExact = 0.0f;
+    float valueQuantized = 0.0f;
+    for (int d = 0; d < 4; ++d) {
+      const Core::BitboardMove result = board.move(static_cast<Core::Direction>(d));
+      if (!result.moved)
+        continue;
+      const float e = static_cast<float>(result.score) + network.evaluate(result.board);
+      const float q = static_cast<float>(result.score) +
+                      quantized.evaluate(level, result.board);
+      if (bestExact < 0 || e > valueExact) {
+        bestExact = d;
+        valueExact = e;
+      }
+      if (bestQuantized < 0 || q > valueQuantized) {
+        bestQuantized = d;
+        valueQuantized = q;
+      }
+    }
+    if (bestExact >= 0) {
+      ++decisions;
+      moveChanges += bestExact != bestQuantized;
+    }
+  }
+
+  BoardCursor boards;
+  for (auto _ : state) {
+    float value = quantized.evaluate(level, boards.next());
+    benchmark::DoNotOptimize(value);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["MB"] = static_cast<double>(quantized.sizeBytes()) / (1 << 20);
+  state.counters["rel_err_%"] = absValue > 0.0 ? 100.0 * absError / absValue : 0.0;
+  state.counters["move_changed_%"] =
+      decisions ? 100.0 * moveChanges / decisions : 0.0;
+  state.SetLabel(std::string(state.range(0) ? "int8" : "int16") +
+                 (state.range(1) ? " AVX2" : " scalar"));
+}
+BENCHMARK(BM_NTupleEvalQuantized)->ArgsProduct({{0, 1}, {0, 1}});
+
+} // namespace
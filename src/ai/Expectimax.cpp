@@ -0,0 +1,295 @@
+#include "Expectimax.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace AI {
+
+namespace {
+
+constexpr Core::Direction DIRECTIONS[] = {
+    Core::Direction::Up, Core::Direction::Down, Core::Direction::Left,
+    Core::Direction::Right};
+
+// Row heuristic weights
+constexpr double LOST_PENALTY = 200000.0;
+constexpr double MONOTONICITY_POWER = 4.0;
+constexpr double MONOTONICITY_WEIGHT = 47.0;
+constexpr double SUM_POWER = 3.5;
+constexpr double SUM_WEIGHT = 11.0;
+constexpr double MERGES_WEIGHT = 700.0;
+constexpr double EMPTY_WEIGHT = 270.0;
+
+// Heuristic value of one packed row (rows and columns alike)
+float rowHeuristic(std::uint16_t row) {
+  int line[4];
+  for (int i = 0; i < 4; ++i)
+    line[i] = (row >> (4 * i)) & 0xF;
+
+  double sum = 0.0;
+  int empty = 0;
+  int merges = 0;
+  int prev = 0;
+  int counter = 0;
+  for (int rank : line) {
+    sum += std::pow(rank, SUM_POWER);
+    if (rank == 0) {
+      ++empty;
+    } else {
+      if (prev == rank) {
+        ++counter;
+      } else if (counter > 0) {
+        merges += 1 + counter;
+        counter = 0;
+      }
+      prev = rank;
+    }
+  }
+  if (counter > 0)
+    merges += 1 + counter;
+
+  double monoLeft = 0.0;
+  double monoRight = 0.0;
+  for (int i = 1; i < 4; ++i) {
+    const double a = std::pow(line[i - 1], MONOTONICITY_POWER);
+    const double b = std::pow(line[i], MONOTONICITY_POWER);
+    if (line[i - 1] > line[i])
+      monoLeft += a - b;
+    else
+      monoRight += b - a;
+  }
+
+  return static_cast<float>(LOST_PENALTY + EMPTY_WEIGHT * empty +
+                            MERGES_WEIGHT * merges -
+                            MONOTONICITY_WEIGHT * std::min(monoLeft, monoRight) -
+                            SUM_WEIGHT * sum);
+}
+
+// rowHeuristic for all 65,536 rows, built once
+const std::array<float, 1 << 16> &heuristicTable() {
+  static const auto table = [] {
+    auto t = std::make_unique<std::array<float, 1 << 16>>();
+    for (int r = 0; r < (1 << 16); ++r)
+      (*t)[r] = rowHeuristic(static_cast<std::uint16_t>(r));
+    return t;
+  }();
+  return *table;
+}
+
+double sumRows(const std::array<float, 1 << 16> &table, std::uint64_t bits) {
+  return table[bits & 0xFFFF] + table[(bits >> 16) & 0xFFFF] +
+         table[(bits >> 32) & 0xFFFF] + table[bits >> 48];
+}
+
+Core::Bitboard withTile(Core::Bitboard board, int cell, int exponent) {
+  return Core::Bitboard(board.raw() |
+                        (static_cast<std::uint64_t>(exponent) << (4 * cell)));
+}
+
+// One search's recursion state (one instance per thread)
+struct Searcher {
+  double cutoff;
+  TranspositionTable *table;
+  const Core::SpawnDistribution &spawns;
+  const std::function<bool()> &stop;
+  std::uint64_t nodes = 0;
+  bool stopped = false; // Values are meaningless once set
+
+  // movesLeft counts player moves still to be searched below this node
+  double maxNode(Core::Bitboard board, int movesLeft, double prob) {
+    ++nodes;
+    if (stop && (nodes & 1023) == 0 && stop())
+      stopped = true;
+    if (stopped)
+      return 0.0;
+    double best = 0.0; // No legal move: lost game
+    for (Core::Direction dir : DIRECTIONS) {
+      const Core::BitboardMove result = board.move(dir);
+      if (result.moved)
+        best = std::max(best, chanceNode(result.board, movesLeft - 1, prob));
+    }
+    return best;
+  }
+
+  double chanceNode(Core::Bitboard board, int movesLeft, double prob) {
+    ++nodes;
+    const std::uint16_t empty = board.emptyMask();
+    if (movesLeft <= 0 || prob < cutoff || empty == 0)
+      return ExpectimaxStrategy::evaluate(board);
+
+    float cached = 0.0f;
+    const int depth = tableDepth(movesLeft, prob);
+    if (table && table->probe(board, depth, cached))
+      return cached;
+
+    const int n = std::popcount(empty);
+    double total = 0.0;
+    for (std::uint16_t cells = empty; cells; cells &= cells - 1)
+      total += spawnAt(board, std::countr_zero(cells), n, movesLeft, prob);
+
+    const double value = total / n;
+    if (table && !stopped)
+      table->store(board, depth, static_cast<float>(value));
+    return value;
+  }
+
+  // Table depth: plies left, then how far the cutoff is from pruning this
+  // node, so values from heavily pruned subtrees do not stand in for
+  // likely positions
+  int tableDepth(int movesLeft, double prob) const {
+    const int slack = std::clamp(std::ilogb(prob / cutoff), 0, 15);
+    return movesLeft * 16 + slack;
+  }
+
+  // Weighted value of every spawn outcome in `cell` (one of n empty cells)
+  double spawnAt(Core::Bitboard board, int cell, int n, int movesLeft,
+                 double prob) {
+    double value = 0.0;
+    for (int i = 0; i < spawns.size(); ++i) {
+      const double p = spawns.probability(i);
+      value += p * maxNode(withTile(board, cell, spawns.outcome(i).exponent),
+                           movesLeft, prob * p / n);
+    }
+    return value;
+  }
+};
+
+} // namespace
+
+ExpectimaxStrategy::ExpectimaxStrategy(const Config &config)
+    : m_config(config) {
+  if (config.maxDepth < 1 || config.maxDepth > MAX_DEPTH)
+    throw std::invalid_argument("Expectimax depth must be between 1 and 15");
+  heuristicTable(); // Build outside the first timed search
+}
+
+double ExpectimaxStrategy::evaluate(Core::Bitboard board) {
+  const auto &table = heuristicTable();
+  return sumRows(table, board.raw()) + sumRows(table, board.transposed().raw());
+}
+
+int ExpectimaxStrategy::depthFor(int emptyCells) const {
+  // Open boards branch widely and are rarely critical; full ones need depth
+  int depth = 2;
+  if (emptyCells <= 3)
+    depth = 4;
+  else if (emptyCells <= 7)
+    depth = 3;
+  return std::min(depth, m_config.maxDepth);
+}
+
+ExpectimaxStrategy::SearchResult
+ExpectimaxStrategy::search(Core::Bitboard board) {
+  return search(board, depthFor(board.countEmpty()));
+}
+
+ExpectimaxStrategy::SearchResult
+ExpectimaxStrategy::search(Core::Bitboard board, int depth) {
+  if (depth < 1 || depth > MAX_DEPTH)
+    throw std::invalid_argument("Expectimax depth must be between 1 and 15");
+  const auto start = std::chrono::steady_clock::now();
+
+  // Root children: boards after each legal move
+  struct Root {
+    Core::Direction dir;
+    Core::Bitboard board;
+    std::uint16_t empty;
+  };
+  std::vector<Root> roots;
+  for (Core::Direction dir : DIRECTIONS) {
+    const Core::BitboardMove result = board.move(dir);
+    if (result.moved)
+      roots.push_back({dir, result.board, result.board.emptyMask()});
+  }
+
+  std::vector<double> values(roots.size(), 0.0);
+  std::uint64_t nodes = 1; // Root max node
+
+  if (m_config.pool == nullptr || depth <= 1) {
+    Searcher searcher{m_config.probabilityCutoff, m_config.table,
+                      m_config.spawns, m_config.stop};
+    for (std::size_t r = 0; r < roots.size(); ++r)
+      values[r] = searcher.chanceNode(roots[r].board, depth - 1, 1.0);
+    nodes += searcher.nodes;
+  } else {
+    // One task per (root move, empty cell) of the first chance layer.
+    // Values are summed afterwards in cell order, so the result is the same
+    // as the sequential search.
+    struct Task {
+      std::size_t root;
+      int cell;
+      int n;
+    };
+    std::vector<Task> tasks;
+    for (std::size_t r = 0; r < roots.size(); ++r) {
+      const int n = std::popcount(roots[r].empty);
+      for (std::uint16_t cells = roots[r].empty; cells; cells &= cells - 1)
+        tasks.push_back({r, std::countr_zero(cells), n});
+    }
+
+    std::vector<double> taskValues(tasks.size());
+    std::vector<std::uint64_t> taskNodes(tasks.size());
+    m_config.pool->parallelFor(
+        tasks.size(), 1,
+        [&](std::uint64_t begin, std::uint64_t end, unsigned) {
+          for (std::uint64_t t = begin; t < end; ++t) {
+            Searcher searcher{m_config.probabilityCutoff, m_config.table,
+                              m_config.spawns, m_config.stop};
+            const Task &task = tasks[t];
+            taskValues[t] = searcher.spawnAt(roots[task.root].board, task.cell,
+                                             task.n, depth - 1, 1.0);
+            taskNodes[t] = searcher.nodes;
+          }
+        });
+
+    for (std::size_t t = 0; t < tasks.size(); ++t) {
+      values[tasks[t].root] += taskValues[t];
+      nodes += taskNodes[t];
+    }
+    for (std::size_t r = 0; r < roots.size(); ++r) {
+      ++nodes; // First-layer chance node
+      values[r] = roots[r].empty ? values[r] / std::popcount(roots[r].empty)
+                                 : evaluate(roots[r].board);
+    }
+  }
+
+  SearchResult result{false, Core::Direction::Up, 0.0, nodes};
+  const bool stopped = m_config.stop && m_config.stop();
+  for (std::size_t r = 0; r < roots.size() && !stopped; ++r) {
+    if (!result.found || values[r] > result.value) {
+      result = {true, roots[r].dir, values[r], nodes};
+    }
+  }
+
+  ++m_stats.searches;
+  m_stats.nodes += nodes;
+  m_stats.seconds += std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+  return result;
+}
+
+Core::Direction ExpectimaxStrategy::chooseMove(const Core::Grid &grid,
+                                               std::uint8_t legalMask,
+                                               Core::Rng &rng) {
+  // The packed board holds exponents up to 15 (32768)
+  for (int y = 0; y < Core::Grid::SIZE; ++y)
+    for (int x = 0; x < Core::Grid::SIZE; ++x)
+      if (grid.getExponent(x, y) > Core::Bitboard::MAX_EXPONENT)
+        return m_fallback.chooseMove(grid, legalMask, rng);
+
+  const SearchResult result = search(Core::Bitboard::fromGrid(grid));
+  // Two 32768 tiles merge on the Grid but not on the packed board
+  if (!result.found || !(legalMask & Core::GameLogic::directionBit(result.move)))
+    return nthLegalMove(legalMask, 0);
+  return result.move;
+}
+
+} // namespace AI
@@ -0,0 +1,88 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "Strategy.hpp"
+#include "TranspositionTable.hpp"
+#include <functional>
+
+namespace AI {
+
+/**
+ * @brief Expectimax player over packed boards.
+ *
+ * Max nodes try every legal move, chance nodes average over every empty
+ * cell receiving each tile of the configured SpawnDistribution (by default
+ * the game's: a 2 at 90%, a 4 at 10%).
+ * Leaves are scored with a row-table heuristic (empty cells, merges,
+ * monotonicity, tile sums) applied to all rows and columns.
+ *
+ * Search depth grows as the board fills up, and chance branches whose
+ * probability falls below a cutoff are evaluated immediately. With a
+ * ThreadPool, root moves and their first chance layer run in parallel; the
+ * chosen move does not depend on the thread count. With a
+ * TranspositionTable, chance nodes reached through different spawn orders
+ * are evaluated once (the table may be shared by any number of searches;
+ * results then depend on what other threads stored first).
+ */
+class ExpectimaxStrategy : public Strategy {
+public:
+  // Deepest search: table entries keep 8 bits of depth (plies below the
+  // root * 16 + cutoff slack)
+  static constexpr int MAX_DEPTH = 15;
+
+  struct Config {
+    int maxDepth = 4; // Player moves looked ahead, root included; 1-MAX_DEPTH
+    double probabilityCutoff = 1e-4;   // Chance branches below this are leaves
+    ThreadPool *pool = nullptr;        // Parallel root + first chance layer
+    TranspositionTable *table = nullptr; // Shared cache of chance-node values
+    Core::SpawnDistribution spawns = Core::SpawnDistribution::classic();
+    // Polled every 1024 nodes (must be thread-safe with a pool); the search
+    // is abandoned once it returns true
+    std::function<bool()> stop;
+  };
+
+  // Outcome of one search
+  struct SearchResult {
+    bool found;         // False if no move changes the board or stopped
+    Core::Direction move;
+    double value;       // Expected heuristic value of `move`
+    std::uint64_t nodes;
+  };
+
+  ExpectimaxStrategy() : ExpectimaxStrategy(Config{}) {}
+  /**
+   * @throws std::invalid_argument if maxDepth is outside [1, MAX_DEPTH].
+   */
+  explicit ExpectimaxStrategy(const Config &config);
+
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "expectimax"; }
+  [[nodiscard]] SearchStats searchStats() const override { return m_stats; }
+
+  /**
+   * @brief Searches a packed board with the depth chosen by depthFor().
+   * Also accumulates searchStats().
+   */
+  SearchResult search(Core::Bitboard board);
+
+  /**
+   * @brief Same at a fixed depth (player moves, root included), for
+   * iterative deepening. A search abandoned through Config::stop returns
+   * found = false and stores nothing in the table.
+   * @throws std::invalid_argument if depth is outside [1, MAX_DEPTH].
+   */
+  SearchResult search(Core::Bitboard board, int depth);
+
+  // Depth used for a board with `emptyCells` empty cells (capped by maxDepth)
+  [[nodiscard]] int depthFor(int emptyCells) const;
+
+  // Static evaluation of a board (higher is better)
+  [[nodiscard]] static double evaluate(Core::Bitboard board);
+
+private:
+  Config m_config;
+  SearchStats m_stats;
+  GreedyStrategy m_fallback; // Boards with tiles above 32768
+};
+
+} // namespace AI
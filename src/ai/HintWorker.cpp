@@ -0,0 +1,98 @@
+#include "HintWorker.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace AI {
+
+namespace {
+
+ExpectimaxStrategy::Config searchConfig(TranspositionTable *table,
+                                        std::function<bool()> stop) {
+  ExpectimaxStrategy::Config config;
+  config.table = table;
+  config.stop = std::move(stop);
+  return config;
+}
+
+} // namespace
+
+HintWorker::HintWorker(const Config &config)
+    : m_config(config),
+      m_table(config.tableEntries
+                  ? std::make_unique<TranspositionTable>(config.tableEntries)
+                  : nullptr),
+      m_search(searchConfig(m_table.get(), [this] {
+        // Runs on the worker: any publish since the search began stops it
+        return m_generation.load(std::memory_order_relaxed) != m_searching;
+      })) {
+  if (config.maxDepth < 1 ||
+      config.maxDepth > ExpectimaxStrategy::MAX_DEPTH)
+    throw std::invalid_argument("Hint depth must be between 1 and 15");
+  m_thread = std::thread([this] { threadMain(); });
+}
+
+HintWorker::~HintWorker() {
+  m_quit.store(true);
+  publish(false);
+  m_thread.join();
+}
+
+void HintWorker::publish(bool hasBoard) {
+  // Only the calling thread writes the generation. Bumping it is also what
+  // stops the running search.
+  const std::uint32_t next =
+      ((m_generation.load(std::memory_order_relaxed) >> 1) + 1) << 1 |
+      (hasBoard ? 1u : 0u);
+  m_generation.store(next);
+  m_generation.notify_one();
+}
+
+void HintWorker::request(Core::Bitboard board) {
+  m_board.store(board.raw());
+  publish(true);
+}
+
+void HintWorker::cancel() { publish(false); }
+
+std::optional<HintWorker::Hint> HintWorker::poll() const {
+  const std::uint32_t generation = m_generation.load(std::memory_order_relaxed);
+  if (!(generation & 1))
+    return std::nullopt;
+  const std::uint64_t result = m_result.load(std::memory_order_acquire);
+  if (static_cast<std::uint32_t>(result >> 16) != generation)
+    return std::nullopt;
+  return Hint{static_cast<Core::Direction>(result & 0xFF),
+              static_cast<int>((result >> 8) & 0xFF)};
+}
+
+void HintWorker::threadMain() {
+  while (true) {
+    const std::uint32_t generation = m_generation.load();
+    if (m_quit.load())
+      return;
+    if (generation == m_searching) {
+      m_generation.wait(generation);
+      continue;
+    }
+    m_searching = generation;
+    if (!(generation & 1))
+      continue; // Cancelled
+
+    // A newer request may already have replaced the board. The generation
+    // then already differs from m_searching, so the search stops within a
+    // thousand nodes, nothing is published, and the loop picks it up
+    const Core::Bitboard board(m_board.load());
+    for (int depth = 1; depth <= m_config.maxDepth; ++depth) {
+      const ExpectimaxStrategy::SearchResult result =
+          m_search.search(board, depth);
+      if (!result.found)
+        break; // Stopped, or no legal move
+      m_result.store(pack(generation, depth, result.move),
+                     std::memory_order_release);
+      if (m_config.onResult)
+        m_config.onResult();
+    }
+  }
+}
+
+} // namespace AI
@@ -0,0 +1,108 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "Expectimax.hpp"
+#include "TranspositionTable.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+
+namespace AI {
+
+/**
+ * @brief Background expectimax analysis of one position at a time.
+ *
+ * request() hands a board to a dedicated thread, which searches it at
+ * depth 1, 2, 3, ... up to Config::maxDepth and publishes the move after
+ * every completed depth. A new request() or cancel() abandons the running
+ * search within about a thousand nodes: the search stops as soon as the
+ * generation differs from the one it started on, so no separate stop flag
+ * can be lost between requests.
+ *
+ * Both directions use single atomic words, so the calling thread (the game
+ * loop) never takes a lock or blocks: the request is a board plus a
+ * generation counter, the result mailbox packs {generation, depth, move}
+ * into one 64-bit value. Results of an older generation are ignored.
+ *
+ * Config::onResult lets an event-driven caller sleep until a result lands
+ * instead of polling on a timer.
+ *
+ * A small private TranspositionTable keeps the chance-node values of each
+ * depth, so the next iteration mostly re-searches its new bottom layer.
+ */
+class HintWorker {
+public:
+  struct Config {
+    int maxDepth = 8;                    // Deepest iteration, 1-15
+    std::size_t tableEntries = 1u << 20; // 16 MB; 0 = no table
+    // Called on the worker thread after each published depth; must be
+    // thread-safe and quick (e.g. post a wake-up event)
+    std::function<void()> onResult;
+  };
+
+  // Best move found so far for the current request
+  struct Hint {
+    Core::Direction move;
+    int depth; // Deepest completed iteration
+    bool operator==(const Hint &other) const = default;
+  };
+
+  HintWorker() : HintWorker(Config{}) {}
+  /**
+   * @throws std::invalid_argument if maxDepth is outside [1, 15].
+   */
+  explicit HintWorker(const Config &config);
+  ~HintWorker(); // Cancels and joins the thread
+
+  HintWorker(const HintWorker &) = delete;
+  HintWorker &operator=(const HintWorker &) = delete;
+
+  // Starts analysing `board`, replacing any previous request. Lock-free.
+  void request(Core::Bitboard board);
+
+  // Drops the current request; poll() returns nothing until the next one.
+  void cancel();
+
+  /**
+   * @brief Latest result for the current request. Lock-free, wait-free.
+   * Empty until depth 1 completes, after cancel(), or when the board has
+   * no legal move.
+   */
+  [[nodiscard]] std::optional<Hint> poll() const;
+
+private:
+  void threadMain();
+
+  // Result word: generation << 16 | depth << 8 | move
+  static constexpr std::uint64_t pack(std::uint32_t generation, int depth,
+                                      Core::Direction move) {
+    return static_cast<std::uint64_t>(generation) << 16 |
+           static_cast<std::uint64_t>(depth) << 8 |
+           static_cast<std::uint64_t>(move);
+  }
+
+  // Next generation number; the low bit marks a pending request
+  void publish(bool hasBoard);
+
+  Config m_config;
+  std::unique_ptr<TranspositionTable> m_table;
+  ExpectimaxStrategy m_search;
+
+  // Written by the caller, read by the worker. 32 bits so that the
+  // worker's wait() maps straight onto a futex.
+  std::atomic<std::uint64_t> m_board{0};
+  std::atomic<std::uint32_t> m_generation{0};
+  std::atomic<bool> m_quit{false};
+
+  // Generation being searched; only the worker thread touches it
+  std::uint32_t m_searching = 0;
+
+  // Written by the worker, read by the caller
+  std::atomic<std::uint64_t> m_result{0};
+
+  std::thread m_thread; // Last member: starts after everything above
+};
+
+} // namespace AI
@@ -0,0 +1,268 @@
+#include "Mcts.hpp"
+#include "ThreadPool.hpp"
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace AI {
+
+namespace {
+
+constexpr std::uint32_t NONE = NodeArena<int>::NONE;
+
+// Longest selection path (decision + afterstate nodes) before a rollout
+constexpr int MAX_PATH = 256;
+
+// k-th empty cell, in Grid::spawnRandomTile order
+int nthEmptyCell(std::uint16_t empty, unsigned k) {
+  for (; k > 0; --k)
+    empty &= static_cast<std::uint16_t>(empty - 1);
+  return std::countr_zero(empty);
+}
+
+Core::Bitboard withTile(Core::Bitboard board, int cell, int exponent) {
+  return Core::Bitboard(board.raw() |
+                        (static_cast<std::uint64_t>(exponent) << (4 * cell)));
+}
+
+// Uniformly random legal moves until the game ends; returns points scored
+std::uint64_t rollout(Core::Bitboard board, Core::Rng &rng,
+                      const Core::SpawnDistribution &spawns,
+                      std::uint64_t &moves) {
+  std::uint64_t score = 0;
+  while (const std::uint8_t mask = board.legalMoves()) {
+    const auto dir = nthLegalMove(
+        mask, rng.nextBelow(static_cast<std::uint32_t>(std::popcount(mask))));
+    const Core::BitboardMove result = board.move(dir);
+    score += static_cast<std::uint64_t>(result.score);
+    board = result.board.spawnRandom(rng, spawns);
+    ++moves;
+  }
+  return score;
+}
+
+} // namespace
+
+MctsStrategy::MctsStrategy(const Config &config) : m_config(config) {
+  if (config.budgetMs <= 0.0 && config.iterations == 0)
+    throw std::invalid_argument("MCTS needs a time budget or an iteration limit");
+  if (config.arenaNodes == 0)
+    throw std::invalid_argument("MCTS arena must hold at least one node");
+
+  const unsigned trees = config.pool ? config.pool->size() : 1;
+  m_arenas.reserve(trees);
+  for (unsigned t = 0; t < trees; ++t)
+    m_arenas.emplace_back(config.arenaNodes);
+  m_seeds.resize(trees);
+  m_results.resize(trees);
+}
+
+MctsStrategy::TreeResult
+MctsStrategy::growTree(Arena &arena, Core::Bitboard board, Core::Rng &rng,
+                       std::chrono::steady_clock::time_point deadline) const {
+  TreeResult out;
+  arena.reset();
+  const std::uint32_t root = arena.allocate(1);
+  arena[root].board = board;
+
+  // Creates the afterstates of a decision node; false if the arena is full
+  const auto expandDecision = [&arena](std::uint32_t index) {
+    Node &node = arena[index];
+    const std::uint8_t mask = node.board.legalMoves();
+    const std::uint32_t first =
+        mask ? arena.allocate(static_cast<std::size_t>(std::popcount(mask)))
+             : 0; // Lost position: expanded, no children
+    if (first == NONE)
+      return false;
+    std::uint32_t child = first;
+    for (std::uint8_t bits = mask; bits; bits &= bits - 1) {
+      const auto dir = static_cast<Core::Direction>(std::countr_zero(bits));
+      const Core::BitboardMove result = node.board.move(dir);
+      Node &after = arena[child++];
+      after.board = result.board;
+      after.reward = static_cast<std::uint32_t>(result.score);
+      after.move = static_cast<std::uint8_t>(dir);
+    }
+    node.firstChild = first;
+    node.childCount = static_cast<std::uint8_t>(std::popcount(mask));
+    return true;
+  };
+
+  // Creates every spawn outcome of an afterstate: per empty cell, one child
+  // per tile of the distribution
+  const Core::SpawnDistribution &spawns = m_config.spawns;
+  const auto expandChance = [&arena, &spawns](std::uint32_t index) {
+    Node &node = arena[index];
+    const int count = node.board.countEmpty() * spawns.size();
+    const std::uint32_t first = arena.allocate(static_cast<std::size_t>(count));
+    if (first == NONE)
+      return false;
+    std::uint32_t child = first;
+    node.board.forEachSpawn(spawns, [&arena, &child](Core::Bitboard next, double) {
+      arena[child++].board = next;
+    });
+    node.firstChild = first;
+    node.childCount = static_cast<std::uint8_t>(count);
+    return true;
+  };
+
+  // UCT over a decision node's afterstates; unvisited moves go first
+  const auto selectMove = [&arena, root, this](const Node &node) {
+    const Node &top = arena[root];
+    const double scale = std::max(1.0, top.total / std::max(1u, top.visits));
+    const double logVisits = std::log(static_cast<double>(node.visits));
+    std::uint32_t best = node.firstChild;
+    double bestScore = -1.0;
+    for (std::uint32_t c = node.firstChild; c < node.firstChild + node.childCount;
+         ++c) {
+      const Node &child = arena[c];
+      if (child.visits == 0)
+        return c;
+      const double score =
+          child.total / child.visits +
+          m_config.exploration * scale * std::sqrt(logVisits / child.visits);
+      if (score > bestScore) {
+        best = c;
+        bestScore = score;
+      }
+    }
+    return best;
+  };
+
+  std::uint32_t path[MAX_PATH];
+  for (std::uint64_t it = 0;
+       m_config.iterations == 0 || it < m_config.iterations; ++it) {
+    if ((it & 31) == 31 && std::chrono::steady_clock::now() >= deadline)
+      break;
+
+    int length = 0;
+    path[length++] = root;
+    std::uint32_t index = root;
+    Core::Bitboard leaf = board;
+    std::uint64_t gained = 0;
+
+    // Selection and expansion: descend until an unvisited node or a full
+    // arena, expanding each node on its second visit
+    while (length + 2 <= MAX_PATH) {
+      Node &node = arena[index];
+      leaf = node.board;
+      if (node.firstChild == NONE &&
+          ((node.visits == 0 && index != root) || !expandDecision(index)))
+        break;
+      if (node.childCount == 0)
+        break; // Lost position
+
+      const std::uint32_t afterIndex = selectMove(node);
+      Node &after = arena[afterIndex];
+      path[length++] = afterIndex;
+      gained += after.reward;
+
+      const std::uint16_t empty = after.board.emptyMask();
+      const auto k =
+          rng.nextBelow(static_cast<std::uint32_t>(std::popcount(empty)));
+      const int outcome = spawns.sampleIndex(rng);
+      if (after.firstChild == NONE && !expandChance(afterIndex)) {
+        leaf = withTile(after.board, nthEmptyCell(empty, k),
+                        spawns.outcome(outcome).exponent);
+        break;
+      }
+      index = after.firstChild + k * spawns.size() + outcome;
+      path[length++] = index;
+      leaf = arena[index].board;
+    }
+
+    const double value =
+        static_cast<double>(gained + rollout(leaf, rng, spawns, out.nodes));
+    for (int i = 0; i < length; ++i) {
+      ++arena[path[i]].visits;
+      arena[path[i]].total += value;
+    }
+    out.nodes += static_cast<std::uint64_t>(length);
+  }
+
+  const Node &top = arena[root];
+  if (top.firstChild != NONE) {
+    for (std::uint32_t c = top.firstChild; c < top.firstChild + top.childCount;
+         ++c) {
+      out.visits[arena[c].move] = arena[c].visits;
+      out.totals[arena[c].move] = arena[c].total;
+    }
+  }
+  return out;
+}
+
+MctsStrategy::SearchResult MctsStrategy::search(Core::Bitboard board,
+                                                Core::Rng &rng) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto deadline =
+      m_config.budgetMs > 0.0
+          ? start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double, std::milli>(m_config.budgetMs))
+          : std::chrono::steady_clock::time_point::max();
+
+  const std::size_t trees = m_arenas.size();
+  for (auto &seed : m_seeds)
+    seed = rng.next();
+
+  const auto grow = [&](std::size_t t) {
+    Core::Rng treeRng(m_seeds[t]);
+    m_results[t] = growTree(m_arenas[t], board, treeRng, deadline);
+  };
+  if (trees > 1) {
+    m_config.pool->parallelFor(
+        trees, 1, [&](std::uint64_t begin, std::uint64_t end, unsigned) {
+          for (std::uint64_t t = begin; t < end; ++t)
+            grow(t);
+        });
+  } else {
+    grow(0);
+  }
+
+  // Most visited move over all trees; ties go to the higher mean
+  SearchResult result{false, Core::Direction::Up, 0, 0.0, 0};
+  for (const TreeResult &tree : m_results)
+    result.nodes += tree.nodes;
+  for (int d = 0; d < 4; ++d) {
+    std::uint64_t visits = 0;
+    double total = 0.0;
+    for (const TreeResult &tree : m_results) {
+      visits += tree.visits[d];
+      total += tree.totals[d];
+    }
+    if (visits == 0)
+      continue;
+    const double mean = total / static_cast<double>(visits);
+    if (!result.found || visits > result.visits ||
+        (visits == result.visits && mean > result.value)) {
+      result.found = true;
+      result.move = static_cast<Core::Direction>(d);
+      result.visits = visits;
+      result.value = mean;
+    }
+  }
+
+  ++m_stats.searches;
+  m_stats.nodes += result.nodes;
+  m_stats.seconds += std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+  return result;
+}
+
+Core::Direction MctsStrategy::chooseMove(const Core::Grid &grid,
+                                         std::uint8_t legalMask,
+                                         Core::Rng &rng) {
+  // The packed board holds exponents up to 15 (32768)
+  for (int y = 0; y < Core::Grid::SIZE; ++y)
+    for (int x = 0; x < Core::Grid::SIZE; ++x)
+      if (grid.getExponent(x, y) > Core::Bitboard::MAX_EXPONENT)
+        return m_fallback.chooseMove(grid, legalMask, rng);
+
+  const SearchResult result = search(Core::Bitboard::fromGrid(grid), rng);
+  // Two 32768 tiles merge on the Grid but not on the packed board
+  if (!result.found || !(legalMask & Core::GameLogic::directionBit(result.move)))
+    return nthLegalMove(legalMask, 0);
+  return result.move;
+}
+
+} // namespace AI
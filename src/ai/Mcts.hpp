@@ -0,0 +1,95 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "NodeArena.hpp"
+#include "Strategy.hpp"
+#include <chrono>
+#include <vector>
+
+namespace AI {
+
+/**
+ * @brief Monte-Carlo tree search player (anytime).
+ *
+ * The tree alternates decision nodes (one child per legal move) and
+ * afterstates (one child per spawn outcome, sampled from the configured
+ * SpawnDistribution). Selection uses UCT; leaves are valued by uniformly random
+ * rollouts on packed boards until the game ends, and a node's value is the
+ * mean score gained from the root.
+ *
+ * Nodes live in a NodeArena per tree and the per-tree seeds and results in
+ * buffers, all allocated once with the strategy, so a search without a pool
+ * never allocates (with one, only the ThreadPool's task dispatch does). A
+ * full arena stops the tree from growing but not the rollouts. A search
+ * runs until the wall-clock budget or the iteration limit is reached. With
+ * a ThreadPool, every worker grows its own tree (root parallelism) and root
+ * visit counts are summed.
+ */
+class MctsStrategy : public Strategy {
+public:
+  struct Config {
+    double budgetMs = 10.0;          // Wall clock per move, 0 = no limit
+    std::uint64_t iterations = 0;    // Per tree, 0 = no limit
+    std::size_t arenaNodes = 1 << 18; // Node capacity per tree
+    double exploration = 0.5;        // UCT constant, relative to the root mean
+    ThreadPool *pool = nullptr;      // One tree per worker
+    Core::SpawnDistribution spawns = Core::SpawnDistribution::classic();
+  };
+
+  // Outcome of one search
+  struct SearchResult {
+    bool found;         // False if no move changes the board
+    Core::Direction move;
+    std::uint64_t visits; // Root visits of `move`, summed over trees
+    double value;       // Mean score gained after `move`
+    std::uint64_t nodes; // Tree nodes visited plus rollout moves
+  };
+
+  MctsStrategy() : MctsStrategy(Config{}) {}
+  /**
+   * @throws std::invalid_argument if neither a budget nor an iteration
+   *         limit is set.
+   */
+  explicit MctsStrategy(const Config &config);
+
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "mcts"; }
+  [[nodiscard]] SearchStats searchStats() const override { return m_stats; }
+
+  /**
+   * @brief Searches a packed board. Tree t samples spawns and rollouts from
+   * a stream seeded by the t-th draw from `rng`, so with an iteration limit
+   * (and no time budget) the result is reproducible.
+   */
+  SearchResult search(Core::Bitboard board, Core::Rng &rng);
+
+private:
+  struct Node {
+    Core::Bitboard board; // Board to move, or afterstate before the spawn
+    double total = 0.0;   // Sum of returns through this node
+    std::uint32_t visits = 0;
+    std::uint32_t firstChild = 0xFFFFFFFFu; // NodeArena::NONE: not expanded
+    std::uint32_t reward = 0; // Afterstates: points scored by the move
+    std::uint8_t childCount = 0;
+    std::uint8_t move = 0; // Afterstates: Direction that produced it
+  };
+  using Arena = NodeArena<Node>;
+
+  struct TreeResult {
+    std::uint64_t visits[4] = {}; // By Direction
+    double totals[4] = {};
+    std::uint64_t nodes = 0;
+  };
+
+  TreeResult growTree(Arena &arena, Core::Bitboard board, Core::Rng &rng,
+                      std::chrono::steady_clock::time_point deadline) const;
+
+  Config m_config;
+  std::vector<Arena> m_arenas; // One per tree
+  std::vector<std::uint64_t> m_seeds; // Per tree, drawn each search
+  std::vector<TreeResult> m_results;  // Per tree, filled each search
+  SearchStats m_stats;
+  GreedyStrategy m_fallback; // Boards with tiles above 32768
+};
+
+} // namespace AI
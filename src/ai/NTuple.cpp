@@ -0,0 +1,263 @@
+#include "NTuple.hpp"
+#include "QuantizedNTuple.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TILETWISTER_HAS_MMAP 1
+#endif
+
+namespace AI {
+
+namespace {
+
+constexpr char MAGIC[8] = {'T', 'T', 'N', 'T', 'U', 'P', 'L', 'E'};
+constexpr std::uint32_t FILE_VERSION = 1;
+constexpr std::size_t FILE_CELLS = 8; // Header room per tuple
+
+// Weights start at byte 256, so a mapped table is cache-line aligned
+struct FileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t tupleCount;
+  std::uint8_t tupleSizes[NTupleNetwork::MAX_TUPLES];
+  std::uint8_t cells[NTupleNetwork::MAX_TUPLES][FILE_CELLS];
+  std::uint8_t reserved[256 - 16 - NTupleNetwork::MAX_TUPLES * (1 + FILE_CELLS)];
+};
+static_assert(sizeof(FileHeader) == 256);
+
+constexpr Core::Direction DIRECTIONS[] = {
+    Core::Direction::Up, Core::Direction::Down, Core::Direction::Left,
+    Core::Direction::Right};
+
+// Best legal move by reward + V(afterstate); false if none
+template <typename Network>
+bool bestAfterstate(const Network &network, Core::Bitboard board,
+                    Core::BitboardMove &best, Core::Direction &bestDir) {
+  bool found = false;
+  float bestValue = 0.0f;
+  for (Core::Direction dir : DIRECTIONS) {
+    const Core::BitboardMove result = board.move(dir);
+    if (!result.moved)
+      continue;
+    const float value =
+        static_cast<float>(result.score) + network.evaluate(result.board);
+    if (!found || value > bestValue) {
+      found = true;
+      bestValue = value;
+      best = result;
+      bestDir = dir;
+    }
+  }
+  return found;
+}
+
+} // namespace
+
+std::vector<NTupleNetwork::Tuple> NTupleNetwork::standardTuples() {
+  return {{0, 1, 2, 3, 4, 5},
+          {4, 5, 6, 7, 8, 9},
+          {0, 1, 2, 4, 5, 6},
+          {4, 5, 6, 8, 9, 10}};
+}
+
+std::vector<NTupleNetwork::Tuple> NTupleNetwork::smallTuples() {
+  return {{0, 1, 2, 3}, {4, 5, 6, 7}, {0, 1, 4, 5}, {5, 6, 9, 10}};
+}
+
+NTupleNetwork::NTupleNetwork(const std::vector<Tuple> &tuples) {
+  setTuples(tuples);
+  m_owned = std::make_unique<float[]>(m_weightCount); // Zeroed
+  m_weights = m_owned.get();
+}
+
+NTupleNetwork::~NTupleNetwork() {
+#ifdef TILETWISTER_HAS_MMAP
+  if (m_mapping)
+    munmap(m_mapping, m_mappingBytes);
+#endif
+}
+
+void NTupleNetwork::setTuples(const std::vector<Tuple> &tuples) {
+  if (tuples.empty() || tuples.size() > MAX_TUPLES)
+    throw std::invalid_argument("N-tuple network needs 1 to 16 tuples");
+  m_tuples = tuples;
+  m_offsets.clear();
+  m_weightCount = 0;
+  for (const Tuple &tuple : tuples) {
+    if (tuple.empty() || tuple.size() > MAX_TUPLE_CELLS)
+      throw std::invalid_argument("N-tuple must have 1 to 6 cells");
+    for (int cell : tuple)
+      if (cell < 0 || cell >= 16)
+        throw std::invalid_argument("N-tuple cell outside the board");
+    m_offsets.push_back(m_weightCount);
+    m_weightCount += std::size_t{1} << (4 * tuple.size());
+  }
+}
+
+std::array<Core::Bitboard, NTupleNetwork::SYMMETRIES>
+NTupleNetwork::symmetries(Core::Bitboard board) {
+  return Core::symmetricImages(board);
+}
+
+float NTupleNetwork::evaluate(Core::Bitboard board) const {
+  const auto images = symmetries(board);
+  float sum = 0.0f;
+  for (std::size_t t = 0; t < m_tuples.size(); ++t)
+    for (Core::Bitboard image : images)
+      sum += std::atomic_ref<float>(m_weights[indexOf(t, image.raw())])
+                 .load(std::memory_order_relaxed);
+  return sum;
+}
+
+void NTupleNetwork::update(Core::Bitboard board, float delta) {
+  const auto images = symmetries(board);
+  for (std::size_t t = 0; t < m_tuples.size(); ++t) {
+    for (Core::Bitboard image : images) {
+      // Load + store rather than an atomic add: lost updates are acceptable
+      std::atomic_ref<float> weight(m_weights[indexOf(t, image.raw())]);
+      weight.store(weight.load(std::memory_order_relaxed) + delta,
+                   std::memory_order_relaxed);
+    }
+  }
+}
+
+void NTupleNetwork::save(const std::string &path) const {
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FILE_VERSION;
+  header.tupleCount = static_cast<std::uint32_t>(m_tuples.size());
+  for (std::size_t t = 0; t < m_tuples.size(); ++t) {
+    header.tupleSizes[t] = static_cast<std::uint8_t>(m_tuples[t].size());
+    for (std::size_t c = 0; c < m_tuples[t].size(); ++c)
+      header.cells[t][c] = static_cast<std::uint8_t>(m_tuples[t][c]);
+  }
+
+  // Write a new file and rename it over the old one: a network mapped from
+  // `path` keeps its pages, and readers never see a partial file
+  const std::string temporary = path + ".tmp";
+  {
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(m_weights),
+              static_cast<std::streamsize>(m_weightCount * sizeof(float)));
+    if (!out)
+      throw std::runtime_error("Cannot write n-tuple weights to " + temporary);
+  }
+  if (std::rename(temporary.c_str(), path.c_str()) != 0)
+    throw std::runtime_error("Cannot replace n-tuple weights file " + path);
+}
+
+std::unique_ptr<NTupleNetwork> NTupleNetwork::load(const std::string &path) {
+  std::ifstream in(path, std::ios::binary);
+  FileHeader header{};
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header.version != FILE_VERSION || header.tupleCount == 0 ||
+      header.tupleCount > MAX_TUPLES)
+    throw std::runtime_error("Not an n-tuple weights file: " + path);
+
+  std::vector<Tuple> tuples(header.tupleCount);
+  for (std::uint32_t t = 0; t < header.tupleCount; ++t) {
+    const std::size_t size = std::min<std::size_t>(header.tupleSizes[t], FILE_CELLS);
+    tuples[t].assign(header.cells[t], header.cells[t] + size);
+  }
+  std::unique_ptr<NTupleNetwork> network(new NTupleNetwork());
+  try {
+    network->setTuples(tuples);
+  } catch (const std::invalid_argument &e) {
+    throw std::runtime_error(path + ": " + e.what());
+  }
+
+#ifdef TILETWISTER_HAS_MMAP
+  const std::size_t bytes = sizeof(FileHeader) + network->m_weightCount * sizeof(float);
+  const int fd = open(path.c_str(), O_RDONLY);
+  struct stat info {};
+  if (fd >= 0 && fstat(fd, &info) == 0 &&
+      static_cast<std::size_t>(info.st_size) == bytes) {
+    // Private mapping: pages load on demand and writes (further training)
+    // never reach the file
+    void *mapping =
+        mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping != MAP_FAILED) {
+      network->m_mapping = mapping;
+      network->m_mappingBytes = bytes;
+      network->m_weights = reinterpret_cast<float *>(
+          static_cast<char *>(mapping) + sizeof(FileHeader));
+      return network;
+    }
+  } else if (fd >= 0) {
+    close(fd);
+  }
+#endif
+
+  network->m_owned = std::make_unique<float[]>(network->m_weightCount);
+  network->m_weights = network->m_owned.get();
+  if (!in.read(reinterpret_cast<char *>(network->m_weights),
+               static_cast<std::streamsize>(network->m_weightCount * sizeof(float))) ||
+      in.peek() != std::char_traits<char>::eof())
+    throw std::runtime_error("Truncated or oversized n-tuple weights file: " + path);
+  return network;
+}
+
+GameRecord playTrainingGame(NTupleNetwork &network, float alpha,
+                            std::uint64_t seed) {
+  Core::Rng rng(seed);
+  Core::Bitboard board = Core::Bitboard().spawnRandom(rng).spawnRandom(rng);
+  const float step = alpha / static_cast<float>(network.featureCount());
+
+  GameRecord record{seed, 0, 0, 0};
+  Core::Bitboard previous;
+  bool hasPrevious = false;
+  Core::BitboardMove best{};
+  Core::Direction dir = Core::Direction::Up;
+  while (bestAfterstate(network, board, best, dir)) {
+    if (hasPrevious) {
+      const float target =
+          static_cast<float>(best.score) + network.evaluate(best.board);
+      network.update(previous, step * (target - network.evaluate(previous)));
+    }
+    previous = best.board;
+    hasPrevious = true;
+
+    record.score += best.score;
+    ++record.moves;
+    board = best.board.spawnRandom(rng);
+  }
+  if (hasPrevious)
+    network.update(previous, -step * network.evaluate(previous));
+
+  record.maxExponent = board.maxExponent();
+  return record;
+}
+
+Core::Direction NTupleStrategy::chooseMove(const Core::Grid &grid,
+                                           std::uint8_t legalMask,
+                                           Core::Rng &rng) {
+  // The packed board holds exponents up to 15 (32768)
+  for (int y = 0; y < Core::Grid::SIZE; ++y)
+    for (int x = 0; x < Core::Grid::SIZE; ++x)
+      if (grid.getExponent(x, y) > Core::Bitboard::MAX_EXPONENT)
+        return m_fallback.chooseMove(grid, legalMask, rng);
+
+  Core::BitboardMove best{};
+  Core::Direction dir = Core::Direction::Up;
+  // Two 32768 tiles merge on the Grid but not on the packed board
+  const Core::Bitboard board = Core::Bitboard::fromGrid(grid);
+  const bool found = m_quantized ? bestAfterstate(*m_quantized, board, best, dir)
+                                 : bestAfterstate(*m_network, board, best, dir);
+  if (!found || !(legalMask & Core::GameLogic::directionBit(dir)))
+    return nthLegalMove(legalMask, 0);
+  return dir;
+}
+
+} // namespace AI
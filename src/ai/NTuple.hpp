@@ -0,0 +1,134 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "Simulator.hpp"
+#include "Strategy.hpp"
+#include "Symmetry.hpp"
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AI {
+
+class QuantizedNTupleNetwork;
+
+/**
+ * @brief N-tuple value network over packed boards.
+ *
+ * Each tuple is a list of cells; its weight table has 16^k entries indexed
+ * by the exponents in those cells. A board's value is the sum, over every
+ * tuple, of the weights looked up on all 8 symmetric images of the board
+ * (rotations and reflections), so one table covers every orientation.
+ *
+ * Weights are accessed through relaxed std::atomic_ref: plain loads and
+ * stores on x86, but self-play threads may update one shared network
+ * without locks (a racing update can be lost, which TD learning tolerates).
+ *
+ * The file format is a 256-byte header followed by the raw little-endian
+ * float tables, so load() maps the file (copy-on-write) instead of reading
+ * it.
+ */
+class NTupleNetwork {
+public:
+  using Tuple = std::vector<int>; // Cells, y * 4 + x
+  static constexpr int MAX_TUPLES = 16;
+  static constexpr int MAX_TUPLE_CELLS = 6; // 16^6 weights = 64 MB per tuple
+  static constexpr int SYMMETRIES = Core::SYMMETRY_COUNT;
+
+  // Two straight and two 2x3 six-cell tuples (256 MB of weights)
+  [[nodiscard]] static std::vector<Tuple> standardTuples();
+  // Four-cell rows and squares (1 MB): trains in seconds, plays weaker
+  [[nodiscard]] static std::vector<Tuple> smallTuples();
+
+  /**
+   * @brief Creates a network with all weights zero.
+   * @throws std::invalid_argument for an empty or oversized tuple set, or
+   *         cells outside the board.
+   */
+  explicit NTupleNetwork(const std::vector<Tuple> &tuples);
+  ~NTupleNetwork();
+
+  NTupleNetwork(const NTupleNetwork &) = delete;
+  NTupleNetwork &operator=(const NTupleNetwork &) = delete;
+
+  /**
+   * @brief Maps a weights file written by save().
+   * @throws std::runtime_error if the file is missing or malformed.
+   */
+  [[nodiscard]] static std::unique_ptr<NTupleNetwork> load(const std::string &path);
+
+  // @throws std::runtime_error if the file cannot be written
+  void save(const std::string &path) const;
+
+  // Sum of the tuple weights over all symmetric images
+  [[nodiscard]] float evaluate(Core::Bitboard board) const;
+
+  // Adds `delta` to every weight that evaluate(board) reads
+  void update(Core::Bitboard board, float delta);
+
+  [[nodiscard]] const std::vector<Tuple> &tuples() const { return m_tuples; }
+  // Weights read per evaluation (tuples x symmetries)
+  [[nodiscard]] int featureCount() const {
+    return static_cast<int>(m_tuples.size()) * SYMMETRIES;
+  }
+  [[nodiscard]] std::size_t weightCount() const { return m_weightCount; }
+  // All tables back to back, in tuple order (do not read while training)
+  [[nodiscard]] const float *weights() const { return m_weights; }
+  [[nodiscard]] bool isMapped() const { return m_mapping != nullptr; }
+
+  // The 8 rotations/reflections of a board, in Core::Symmetry order
+  [[nodiscard]] static std::array<Core::Bitboard, SYMMETRIES>
+  symmetries(Core::Bitboard board);
+
+private:
+  NTupleNetwork() = default;
+  void setTuples(const std::vector<Tuple> &tuples);
+
+  // Index into tuple t's table for one board image
+  [[nodiscard]] std::size_t indexOf(std::size_t t, std::uint64_t bits) const {
+    std::size_t index = 0;
+    for (int cell : m_tuples[t])
+      index = (index << 4) | ((bits >> (4 * cell)) & 0xF);
+    return m_offsets[t] + index;
+  }
+
+  std::vector<Tuple> m_tuples;
+  std::vector<std::size_t> m_offsets; // First weight of each tuple's table
+  std::size_t m_weightCount = 0;
+  float *m_weights = nullptr;
+  std::unique_ptr<float[]> m_owned; // Set unless the file is mapped
+  void *m_mapping = nullptr;
+  std::size_t m_mappingBytes = 0;
+};
+
+/**
+ * @brief Plays one self-play game and learns from it with afterstate TD(0).
+ *
+ * Moves maximize reward + V(afterstate); after each move the previous
+ * afterstate's value moves towards the new reward + value by
+ * alpha / featureCount() (towards 0 at the end of the game).
+ *
+ * @param seed Spawns use Rng(seed), as in Simulator::playGame.
+ */
+GameRecord playTrainingGame(NTupleNetwork &network, float alpha,
+                            std::uint64_t seed);
+
+// Picks the move with the best reward + network value of the afterstate
+class NTupleStrategy : public Strategy {
+public:
+  explicit NTupleStrategy(const NTupleNetwork &network) : m_network(&network) {}
+  explicit NTupleStrategy(const QuantizedNTupleNetwork &network)
+      : m_quantized(&network) {}
+
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "ntuple"; }
+
+private:
+  const NTupleNetwork *m_network = nullptr;
+  const QuantizedNTupleNetwork *m_quantized = nullptr; // Used if set
+  GreedyStrategy m_fallback; // Boards with tiles above 32768
+};
+
+} // namespace AI
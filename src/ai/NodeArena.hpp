@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace AI {
+
+/**
+ * @brief Fixed-capacity pool of tree nodes in one contiguous block.
+ *
+ * Nodes are addressed by 32-bit index, allocated in runs (e.g. all children
+ * of a node at once) and released together by reset(). The block is
+ * allocated once, so building a tree never touches the heap; when it is
+ * full, allocate() fails and the caller stops growing the tree.
+ */
+template <typename Node> class NodeArena {
+public:
+  static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+  explicit NodeArena(std::size_t capacity)
+      : m_nodes(std::make_unique<Node[]>(capacity)), m_capacity(capacity) {}
+
+  /**
+   * @brief Allocates `count` value-initialized consecutive nodes.
+   * @return Index of the first node, or NONE if the arena is full.
+   */
+  std::uint32_t allocate(std::size_t count) {
+    if (count > m_capacity - m_size)
+      return NONE;
+    const auto first = static_cast<std::uint32_t>(m_size);
+    for (std::size_t i = 0; i < count; ++i)
+      m_nodes[m_size + i] = Node{};
+    m_size += count;
+    return first;
+  }
+
+  // Releases every node (storage is kept)
+  void reset() { m_size = 0; }
+
+  Node &operator[](std::uint32_t index) { return m_nodes[index]; }
+  const Node &operator[](std::uint32_t index) const { return m_nodes[index]; }
+
+  [[nodiscard]] std::size_t size() const { return m_size; }
+  [[nodiscard]] std::size_t capacity() const { return m_capacity; }
+
+private:
+  std::unique_ptr<Node[]> m_nodes;
+  std::size_t m_capacity;
+  std::size_t m_size = 0;
+};
+
+} // namespace AI
@@ -0,0 +1,168 @@
+#include "QuantizedNTuple.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define TILETWISTER_NTUPLE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace AI {
+
+namespace {
+
+// Extra zero entries after the last table: a gather reads 4 bytes at the
+// address of a 1- or 2-byte weight
+constexpr std::size_t GATHER_PADDING = 4;
+
+template <typename Int>
+void quantize(const float *weights, std::size_t count, float scale, Int *out) {
+  const float limit = static_cast<float>(std::numeric_limits<Int>::max());
+  for (std::size_t i = 0; i < count; ++i) {
+    const float q = std::nearbyint(weights[i] / scale);
+    out[i] = static_cast<Int>(std::clamp(q, -limit, limit));
+  }
+}
+
+} // namespace
+
+QuantizedNTupleNetwork::QuantizedNTupleNetwork(const NTupleNetwork &network,
+                                               WeightPrecision precision)
+    : m_precision(precision) {
+  const float limit = precision == WeightPrecision::Int16 ? 32767.0f : 127.0f;
+  const std::size_t total = network.weightCount() + GATHER_PADDING;
+  if (precision == WeightPrecision::Int16)
+    m_weights16.assign(total, 0);
+  else
+    m_weights8.assign(total, 0);
+
+  std::size_t offset = 0;
+  for (const NTupleNetwork::Tuple &tuple : network.tuples()) {
+    TupleLayout layout{static_cast<std::uint32_t>(offset),
+                       static_cast<std::uint8_t>(tuple.size()),
+                       {}};
+    std::copy(tuple.begin(), tuple.end(), layout.cells);
+    m_layout.push_back(layout);
+
+    const std::size_t count = std::size_t{1} << (4 * tuple.size());
+    const float *weights = network.weights() + offset;
+    float largest = 0.0f;
+    for (std::size_t i = 0; i < count; ++i)
+      largest = std::max(largest, std::fabs(weights[i]));
+    const float scale = largest > 0.0f ? largest / limit : 1.0f;
+    m_scales.push_back(scale);
+
+    if (precision == WeightPrecision::Int16)
+      quantize(weights, count, scale, m_weights16.data() + offset);
+    else
+      quantize(weights, count, scale, m_weights8.data() + offset);
+    offset += count;
+  }
+}
+
+float QuantizedNTupleNetwork::evaluateScalar(Core::Bitboard board) const {
+  const auto images = NTupleNetwork::symmetries(board);
+  float sum = 0.0f;
+  for (std::size_t t = 0; t < m_layout.size(); ++t) {
+    const TupleLayout &layout = m_layout[t];
+    std::int32_t tupleSum = 0;
+    for (Core::Bitboard image : images) {
+      std::uint32_t index = 0;
+      for (int c = 0; c < layout.size; ++c)
+        index = (index << 4) | ((image.raw() >> (4 * layout.cells[c])) & 0xF);
+      tupleSum += m_precision == WeightPrecision::Int16
+                      ? m_weights16[layout.offset + index]
+                      : m_weights8[layout.offset + index];
+    }
+    sum += static_cast<float>(tupleSum) * m_scales[t];
+  }
+  return sum;
+}
+
+#ifdef TILETWISTER_NTUPLE_X86
+
+__attribute__((target("avx2"))) float
+QuantizedNTupleNetwork::evaluateAvx2(Core::Bitboard board) const {
+  // Images 0-3 and 4-7 as 64-bit lanes
+  const auto images = NTupleNetwork::symmetries(board);
+  const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&images[0]));
+  const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&images[4]));
+  const __m256i nibble = _mm256_set1_epi64x(0xF);
+  const __m256i evenLanes = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+  const bool wide = m_precision == WeightPrecision::Int16;
+  const int *base = wide ? reinterpret_cast<const int *>(m_weights16.data())
+                         : reinterpret_cast<const int *>(m_weights8.data());
+
+  __m256 sum = _mm256_setzero_ps();
+  for (std::size_t t = 0; t < m_layout.size(); ++t) {
+    const TupleLayout &layout = m_layout[t];
+    __m256i indexLow = _mm256_setzero_si256();
+    __m256i indexHigh = _mm256_setzero_si256();
+    for (int c = 0; c < layout.size; ++c) {
+      const __m128i shift = _mm_cvtsi32_si128(4 * layout.cells[c]);
+      indexLow = _mm256_or_si256(_mm256_slli_epi64(indexLow, 4),
+                                 _mm256_and_si256(_mm256_srl_epi64(low, shift), nibble));
+      indexHigh = _mm256_or_si256(_mm256_slli_epi64(indexHigh, 4),
+                                  _mm256_and_si256(_mm256_srl_epi64(high, shift), nibble));
+    }
+    // Narrow the 8 indices (< 2^24) to 32-bit lanes and add the table offset
+    const __m128i packedLow = _mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(indexLow, evenLanes));
+    const __m128i packedHigh = _mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(indexHigh, evenLanes));
+    const __m256i index = _mm256_add_epi32(
+        _mm256_inserti128_si256(_mm256_castsi128_si256(packedLow), packedHigh, 1),
+        _mm256_set1_epi32(static_cast<int>(layout.offset)));
+
+    // Gather 32 bits at each weight and keep its sign-extended low part
+    __m256i weights;
+    if (wide) {
+      weights = _mm256_i32gather_epi32(base, index, 2);
+      weights = _mm256_srai_epi32(_mm256_slli_epi32(weights, 16), 16);
+    } else {
+      weights = _mm256_i32gather_epi32(base, index, 1);
+      weights = _mm256_srai_epi32(_mm256_slli_epi32(weights, 24), 24);
+    }
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_cvtepi32_ps(weights),
+                                           _mm256_set1_ps(m_scales[t])));
+  }
+
+  __m128 half = _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+  half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+  half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+  return _mm_cvtss_f32(half);
+}
+
+#else
+
+float QuantizedNTupleNetwork::evaluateAvx2(Core::Bitboard board) const {
+  return evaluateScalar(board); // Never selected: no AVX2 support
+}
+
+#endif // TILETWISTER_NTUPLE_X86
+
+Core::SimdLevel QuantizedNTupleNetwork::preferredLevel() {
+  // Unlike BatchMove's small tables, these lookups miss the cache; a gather
+  // overlaps the 8 misses, which pays off even where it is microcoded (AMD)
+  return Core::BatchMove::isSupported(Core::SimdLevel::AVX2)
+             ? Core::SimdLevel::AVX2
+             : Core::SimdLevel::Scalar;
+}
+
+float QuantizedNTupleNetwork::evaluate(Core::Bitboard board) const {
+  static const bool useAvx2 = preferredLevel() == Core::SimdLevel::AVX2;
+  return useAvx2 ? evaluateAvx2(board) : evaluateScalar(board);
+}
+
+float QuantizedNTupleNetwork::evaluate(Core::SimdLevel level,
+                                       Core::Bitboard board) const {
+  if (!Core::BatchMove::isSupported(level))
+    throw std::invalid_argument("NTuple: SIMD level not supported by CPU");
+  return level == Core::SimdLevel::AVX2 ? evaluateAvx2(board)
+                                        : evaluateScalar(board);
+}
+
+} // namespace AI
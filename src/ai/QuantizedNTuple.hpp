@@ -0,0 +1,67 @@
+#pragma once
+#include "BatchMove.hpp"
+#include "NTuple.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace AI {
+
+// Integer width of quantized n-tuple weights
+enum class WeightPrecision { Int16, Int8 };
+
+/**
+ * @brief Read-only, integer copy of an NTupleNetwork for fast inference.
+ *
+ * Every tuple's table is scaled by its own factor so that its largest
+ * weight maps to the integer limit (32767 or 127) and rounded. That makes
+ * the standard network 128 MB (int16) or 64 MB (int8) instead of 256 MB,
+ * so more of it stays in cache during a search.
+ *
+ * The AVX2 kernel evaluates one tuple per step: the 8 symmetric images give
+ * exactly 8 table indices, fetched with a single 32-bit gather and
+ * sign-extended in place (tables are padded so the wide reads stay in
+ * bounds). Other CPUs use a scalar loop.
+ */
+class QuantizedNTupleNetwork {
+public:
+  QuantizedNTupleNetwork(const NTupleNetwork &network,
+                         WeightPrecision precision);
+
+  // Same value as NTupleNetwork::evaluate, up to rounding
+  [[nodiscard]] float evaluate(Core::Bitboard board) const;
+
+  /**
+   * @brief Same, forcing a kernel (tests / benchmarks). SSE4.1 has no
+   * gathers and runs the scalar kernel.
+   * @throws std::invalid_argument if the CPU does not support it.
+   */
+  [[nodiscard]] float evaluate(Core::SimdLevel level, Core::Bitboard board) const;
+
+  // Kernel evaluate() uses: AVX2 when the CPU has it, else scalar
+  [[nodiscard]] static Core::SimdLevel preferredLevel();
+
+  [[nodiscard]] WeightPrecision precision() const { return m_precision; }
+  [[nodiscard]] float scale(std::size_t tuple) const { return m_scales[tuple]; }
+  [[nodiscard]] std::size_t sizeBytes() const {
+    return m_precision == WeightPrecision::Int16 ? m_weights16.size() * 2
+                                                 : m_weights8.size();
+  }
+
+private:
+  [[nodiscard]] float evaluateScalar(Core::Bitboard board) const;
+  [[nodiscard]] float evaluateAvx2(Core::Bitboard board) const;
+
+  struct TupleLayout {
+    std::uint32_t offset; // First weight of the table
+    std::uint8_t size;
+    std::uint8_t cells[NTupleNetwork::MAX_TUPLE_CELLS];
+  };
+
+  WeightPrecision m_precision;
+  std::vector<TupleLayout> m_layout;
+  std::vector<float> m_scales; // Weight = integer * scale, per tuple
+  std::vector<std::int16_t> m_weights16;
+  std::vector<std::int8_t> m_weights8;
+};
+
+} // namespace AI
@@ -0,0 +1,152 @@
+#include "Simulator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace AI {
+
+void SimulationStats::add(const GameRecord &game) {
+  ++games;
+  moves += static_cast<std::uint64_t>(game.moves);
+  scores.push_back(game.score);
+  ++maxTileCounts[std::min(game.maxExponent, MAX_EXPONENT)];
+}
+
+double SimulationStats::gamesPerSecond() const {
+  return seconds > 0.0 ? static_cast<double>(games) / seconds : 0.0;
+}
+
+double SimulationStats::movesPerSecond() const {
+  return seconds > 0.0 ? static_cast<double>(moves) / seconds : 0.0;
+}
+
+double SimulationStats::meanScore() const {
+  if (scores.empty())
+    return 0.0;
+  double sum = 0.0;
+  for (int s : scores)
+    sum += s;
+  return sum / static_cast<double>(scores.size());
+}
+
+std::vector<int> SimulationStats::sortedScores() const {
+  // Sorts a copy, so the stats stay in seed order
+  std::vector<int> sorted = scores;
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+int SimulationStats::scorePercentile(double p) const {
+  return scorePercentile(sortedScores(), p);
+}
+
+int SimulationStats::scorePercentile(const std::vector<int> &sorted,
+                                     double p) {
+  if (sorted.empty())
+    return 0;
+  const auto rank = static_cast<std::size_t>(
+      std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * sorted.size()));
+  return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+namespace {
+
+// Per-worker counters; alignas keeps two workers off the same cache line
+struct alignas(64) WorkerTally {
+  std::uint64_t games = 0;
+  std::uint64_t moves = 0;
+  std::array<std::uint64_t, SimulationStats::MAX_EXPONENT + 1> maxTileCounts{};
+};
+
+} // namespace
+
+GameRecord Simulator::playGame(std::uint64_t seed) {
+  Core::Rng rng(seed);
+  Core::Grid grid;
+  grid.spawnRandomTile(rng, m_spawns);
+  grid.spawnRandomTile(rng, m_spawns);
+
+  GameRecord record{seed, 0, 0, 0};
+  while (const std::uint8_t legal = Core::GameLogic::legalMoves(grid)) {
+    const Core::Direction dir = m_strategy.chooseMove(grid, legal, rng);
+    const auto result = m_logic.moveFast(grid, dir);
+    if (!result.moved) {
+      throw std::logic_error("Strategy '" + m_strategy.name() +
+                             "' chose an illegal move");
+    }
+    record.score += result.score;
+    grid.spawnRandomTile(rng, m_spawns);
+    ++record.moves;
+  }
+
+  for (int y = 0; y < Core::Grid::SIZE; ++y)
+    for (int x = 0; x < Core::Grid::SIZE; ++x)
+      record.maxExponent = std::max(record.maxExponent, grid.getExponent(x, y));
+  return record;
+}
+
+SimulationStats Simulator::run(std::uint64_t firstSeed, std::uint64_t games) {
+  SimulationStats stats;
+  stats.scores.reserve(games);
+  const SearchStats searchBefore = m_strategy.searchStats();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::uint64_t i = 0; i < games; ++i)
+    stats.add(playGame(firstSeed + i));
+  stats.seconds = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+  const SearchStats searchAfter = m_strategy.searchStats();
+  stats.search.searches = searchAfter.searches - searchBefore.searches;
+  stats.search.nodes = searchAfter.nodes - searchBefore.nodes;
+  stats.search.seconds = searchAfter.seconds - searchBefore.seconds;
+  return stats;
+}
+
+SimulationStats Simulator::runParallel(ThreadPool &pool,
+                                       const StrategyFactory &factory,
+                                       std::uint64_t firstSeed,
+                                       std::uint64_t games,
+                                       const Core::SpawnDistribution &spawns) {
+  std::vector<std::unique_ptr<Strategy>> strategies;
+  for (unsigned w = 0; w < pool.size(); ++w)
+    strategies.push_back(factory());
+  std::vector<WorkerTally> tallies(pool.size());
+
+  SimulationStats stats;
+  stats.scores.resize(games);
+
+  // Small chunks keep the tail short; stealing evens out long games
+  constexpr std::uint64_t GRAIN = 64;
+  const auto start = std::chrono::steady_clock::now();
+  pool.parallelFor(games, GRAIN,
+                   [&](std::uint64_t begin, std::uint64_t end, unsigned worker) {
+                     Simulator simulator(*strategies[worker], spawns);
+                     WorkerTally &tally = tallies[worker];
+                     for (std::uint64_t i = begin; i < end; ++i) {
+                       const GameRecord game = simulator.playGame(firstSeed + i);
+                       stats.scores[i] = game.score;
+                       ++tally.games;
+                       tally.moves += static_cast<std::uint64_t>(game.moves);
+                       ++tally.maxTileCounts[std::min(
+                           game.maxExponent, SimulationStats::MAX_EXPONENT)];
+                     }
+                   });
+  stats.seconds = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+
+  for (const auto &strategy : strategies)
+    stats.search.add(strategy->searchStats());
+  for (const WorkerTally &tally : tallies) {
+    stats.games += tally.games;
+    stats.moves += tally.moves;
+    for (int e = 0; e <= SimulationStats::MAX_EXPONENT; ++e)
+      stats.maxTileCounts[e] += tally.maxTileCounts[e];
+  }
+  return stats;
+}
+
+} // namespace AI
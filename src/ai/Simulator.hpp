@@ -0,0 +1,95 @@
+#pragma once
+#include "GameLogic.hpp"
+#include "Strategy.hpp"
+#include "ThreadPool.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace AI {
+
+// Outcome of one complete game
+struct GameRecord {
+  std::uint64_t seed;
+  int score;
+  int maxExponent; // log2 of the largest tile
+  int moves;
+};
+
+/**
+ * @brief Aggregated results of many simulated games.
+ */
+struct SimulationStats {
+  static constexpr int MAX_EXPONENT = 17; // 131072, the largest reachable tile
+
+  std::uint64_t games = 0;
+  std::uint64_t moves = 0;
+  double seconds = 0.0;
+  std::vector<int> scores; // One per game, in seed order
+  std::array<std::uint64_t, MAX_EXPONENT + 1> maxTileCounts{}; // By log2
+  SearchStats search; // Summed over all strategies (searching ones only)
+
+  void add(const GameRecord &game);
+
+  [[nodiscard]] double gamesPerSecond() const;
+  [[nodiscard]] double movesPerSecond() const;
+  [[nodiscard]] double meanScore() const;
+
+  // Copy of the scores in ascending order, for several percentile lookups
+  [[nodiscard]] std::vector<int> sortedScores() const;
+
+  /**
+   * @brief Score at percentile p (nearest rank).
+   * @param p In [0, 100]. Returns 0 when no game was played.
+   */
+  [[nodiscard]] int scorePercentile(double p) const;
+
+  // Same, indexing into scores already sorted by sortedScores()
+  [[nodiscard]] static int scorePercentile(const std::vector<int> &sorted,
+                                           double p);
+};
+
+/**
+ * @brief Plays complete games headlessly: no window, fonts or audio.
+ *
+ * Game i of a run uses Rng(firstSeed + i) for both spawns and the strategy,
+ * so a seed always replays the same game. Tiles spawn from the given
+ * distribution (the classic 90/10 split by default).
+ */
+class Simulator {
+public:
+  explicit Simulator(Strategy &strategy,
+                     const Core::SpawnDistribution &spawns =
+                         Core::SpawnDistribution::classic())
+      : m_strategy(strategy), m_spawns(spawns) {}
+
+  /**
+   * @brief Plays one game from two spawned tiles until no move is legal.
+   * @throws std::logic_error if the strategy returns an illegal move.
+   */
+  GameRecord playGame(std::uint64_t seed);
+
+  // Plays games with seeds [firstSeed, firstSeed + games)
+  SimulationStats run(std::uint64_t firstSeed, std::uint64_t games);
+
+  /**
+   * @brief Same seed range spread over every worker of `pool`.
+   *
+   * Each worker plays with its own strategy from `factory` and counts into
+   * its own cache-line-padded tally. Games are seeded by index, so the
+   * result equals run() for any thread count (except `seconds`).
+   */
+  static SimulationStats runParallel(ThreadPool &pool,
+                                     const StrategyFactory &factory,
+                                     std::uint64_t firstSeed,
+                                     std::uint64_t games,
+                                     const Core::SpawnDistribution &spawns =
+                                         Core::SpawnDistribution::classic());
+
+private:
+  Strategy &m_strategy;
+  Core::SpawnDistribution m_spawns;
+  Core::GameLogic m_logic;
+};
+
+} // namespace AI
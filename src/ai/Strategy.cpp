@@ -0,0 +1,86 @@
+#include "Strategy.hpp"
+#include "Expectimax.hpp"
+#include "Mcts.hpp"
+#include <bit>
+#include <stdexcept>
+
+namespace AI {
+
+Core::Direction nthLegalMove(std::uint8_t legalMask, unsigned k) {
+  for (; k > 0; --k)
+    legalMask &= static_cast<std::uint8_t>(legalMask - 1);
+  return static_cast<Core::Direction>(std::countr_zero(legalMask));
+}
+
+Core::Direction RandomStrategy::chooseMove(const Core::Grid &,
+                                           std::uint8_t legalMask,
+                                           Core::Rng &rng) {
+  return nthLegalMove(legalMask, rng.nextBelow(static_cast<std::uint32_t>(
+                                     std::popcount(legalMask))));
+}
+
+Core::Direction CornerStrategy::chooseMove(const Core::Grid &,
+                                           std::uint8_t legalMask,
+                                           Core::Rng &) {
+  for (Core::Direction dir : {Core::Direction::Down, Core::Direction::Left,
+                              Core::Direction::Right, Core::Direction::Up}) {
+    if (legalMask & Core::GameLogic::directionBit(dir))
+      return dir;
+  }
+  return Core::Direction::Up; // Unreachable with a non-empty mask
+}
+
+Core::Direction GreedyStrategy::chooseMove(const Core::Grid &grid,
+                                           std::uint8_t legalMask,
+                                           Core::Rng &) {
+  Core::Direction best = nthLegalMove(legalMask, 0);
+  int bestScore = -1;
+  int bestEmpty = -1;
+
+  for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                              Core::Direction::Left, Core::Direction::Right}) {
+    if (!(legalMask & Core::GameLogic::directionBit(dir)))
+      continue;
+    Core::Grid next = grid;
+    const int score = m_logic.moveFast(next, dir).score;
+    const int empty = std::popcount(next.emptyMask());
+    if (score > bestScore || (score == bestScore && empty > bestEmpty)) {
+      best = dir;
+      bestScore = score;
+      bestEmpty = empty;
+    }
+  }
+  return best;
+}
+
+std::unique_ptr<Strategy> makeStrategy(const std::string &name,
+                                       ThreadPool *searchPool,
+                                       TranspositionTable *table,
+                                       double moveBudgetMs) {
+  if (name == "random")
+    return std::make_unique<RandomStrategy>();
+  if (name == "corner")
+    return std::make_unique<CornerStrategy>();
+  if (name == "greedy")
+    return std::make_unique<GreedyStrategy>();
+  if (name == "expectimax") {
+    ExpectimaxStrategy::Config config;
+    config.pool = searchPool;
+    config.table = table;
+    return std::make_unique<ExpectimaxStrategy>(config);
+  }
+  if (name == "mcts") {
+    MctsStrategy::Config config;
+    config.pool = searchPool;
+    if (moveBudgetMs > 0.0)
+      config.budgetMs = moveBudgetMs;
+    return std::make_unique<MctsStrategy>(config);
+  }
+  throw std::invalid_argument("Unknown strategy: " + name);
+}
+
+std::vector<std::string> strategyNames() {
+  return {"random", "corner", "greedy", "expectimax", "mcts"};
+}
+
+} // namespace AI
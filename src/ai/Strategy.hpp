@@ -0,0 +1,113 @@
+#pragma once
+#include "GameLogic.hpp"
+#include "Grid.hpp"
+#include "Rng.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AI {
+
+class ThreadPool;
+class TranspositionTable;
+
+// Work done by a searching strategy (all zero for non-searching ones)
+struct SearchStats {
+  std::uint64_t searches = 0; // chooseMove calls that ran a search
+  std::uint64_t nodes = 0;    // Max + chance nodes visited
+  double seconds = 0.0;       // Wall time spent searching
+
+  void add(const SearchStats &other) {
+    searches += other.searches;
+    nodes += other.nodes;
+    seconds += other.seconds;
+  }
+  [[nodiscard]] double nodesPerSecond() const {
+    return seconds > 0.0 ? static_cast<double>(nodes) / seconds : 0.0;
+  }
+  [[nodiscard]] double averageSearchMs() const {
+    return searches ? 1000.0 * seconds / static_cast<double>(searches) : 0.0;
+  }
+};
+
+/**
+ * @brief A policy that picks the next move of a game.
+ *
+ * Strategies only read the board. A Simulator may call chooseMove from one
+ * thread per instance; any state lives in the implementation.
+ */
+class Strategy {
+public:
+  virtual ~Strategy() = default;
+
+  /**
+   * @brief Chooses a move.
+   * @param grid Current board.
+   * @param legalMask GameLogic::legalMoves(grid), never 0.
+   * @param rng The game's random source (for randomized strategies).
+   * @return A direction whose bit is set in legalMask.
+   */
+  virtual Core::Direction chooseMove(const Core::Grid &grid,
+                                     std::uint8_t legalMask,
+                                     Core::Rng &rng) = 0;
+
+  [[nodiscard]] virtual std::string name() const = 0;
+
+  // Accumulated search work since construction
+  [[nodiscard]] virtual SearchStats searchStats() const { return {}; }
+};
+
+// Uniformly random legal move (baseline)
+class RandomStrategy : public Strategy {
+public:
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "random"; }
+};
+
+// First legal move in Down, Left, Right, Up order (keeps tiles in a corner)
+class CornerStrategy : public Strategy {
+public:
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "corner"; }
+};
+
+// Highest immediate merge score, ties broken by the most empty cells
+class GreedyStrategy : public Strategy {
+public:
+  Core::Direction chooseMove(const Core::Grid &grid, std::uint8_t legalMask,
+                             Core::Rng &rng) override;
+  [[nodiscard]] std::string name() const override { return "greedy"; }
+
+private:
+  Core::GameLogic m_logic;
+};
+
+// Creates a fresh strategy, e.g. one per worker thread
+using StrategyFactory = std::function<std::unique_ptr<Strategy>()>;
+
+/**
+ * @brief Creates a strategy by name.
+ * @param searchPool Optional pool that searching strategies spread each
+ *        search over. Leave null when games already run in parallel.
+ * @param table Optional transposition table for searching strategies (may
+ *        be shared by all of them).
+ * @param moveBudgetMs Wall-clock budget per move for anytime strategies
+ *        (mcts); 0 keeps their default.
+ * @throws std::invalid_argument for an unknown name.
+ */
+std::unique_ptr<Strategy> makeStrategy(const std::string &name,
+                                       ThreadPool *searchPool = nullptr,
+                                       TranspositionTable *table = nullptr,
+                                       double moveBudgetMs = 0.0);
+
+// Names accepted by makeStrategy()
+std::vector<std::string> strategyNames();
+
+// k-th set bit of a legal-move mask as a Direction (k < popcount(mask))
+Core::Direction nthLegalMove(std::uint8_t legalMask, unsigned k);
+
+} // namespace AI
@@ -0,0 +1,121 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+namespace AI {
+
+ThreadPool::ThreadPool(unsigned threads, std::uint64_t seed) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+
+  Core::Rng stream(seed);
+  for (unsigned w = 0; w < threads; ++w) {
+    stream.jump();
+    m_queues.push_back(std::make_unique<WorkerQueue>());
+    m_queues.back()->rng = stream;
+  }
+  for (unsigned w = 0; w < threads; ++w)
+    m_workers.emplace_back([this, w] { workerLoop(w); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for (auto &worker : m_workers)
+    worker.join();
+}
+
+void ThreadPool::submit(Task task) {
+  const unsigned target = m_nextQueue.fetch_add(1) % size();
+  m_pending.fetch_add(1);
+  {
+    // Counted under the sleep lock so that a worker cannot miss it, and
+    // before the push so that the count never goes negative
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_queued.fetch_add(1);
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_queues[target]->mutex);
+    m_queues[target]->tasks.push_back(std::move(task));
+  }
+  m_wake.notify_one();
+}
+
+void ThreadPool::wait() {
+  std::unique_lock<std::mutex> lock(m_sleepMutex);
+  m_idle.wait(lock, [this] { return m_pending.load() == 0; });
+  if (m_error) {
+    std::exception_ptr error = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::parallelFor(
+    std::uint64_t count, std::uint64_t grain,
+    const std::function<void(std::uint64_t, std::uint64_t, unsigned)> &fn) {
+  grain = std::max<std::uint64_t>(grain, 1);
+  for (std::uint64_t begin = 0; begin < count; begin += grain) {
+    const std::uint64_t end = std::min(count, begin + grain);
+    submit([&fn, begin, end](unsigned worker) { fn(begin, end, worker); });
+  }
+  wait();
+}
+
+bool ThreadPool::popOwn(unsigned worker, Task &task) {
+  WorkerQueue &queue = *m_queues[worker];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return false;
+  task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  return true;
+}
+
+bool ThreadPool::steal(unsigned thief, Task &task) {
+  for (unsigned i = 1; i < size(); ++i) {
+    WorkerQueue &victim = *m_queues[(thief + i) % size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::finishTask() {
+  if (m_pending.fetch_sub(1) == 1) {
+    std::lock_guard<std::mutex> lock(m_sleepMutex);
+    m_idle.notify_all();
+  }
+}
+
+void ThreadPool::workerLoop(unsigned worker) {
+  Task task;
+  for (;;) {
+    if (popOwn(worker, task) || steal(worker, task)) {
+      m_queued.fetch_sub(1);
+      try {
+        task(worker);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        if (!m_error)
+          m_error = std::current_exception();
+      }
+      task = nullptr;
+      finishTask();
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    m_wake.wait(lock, [this] { return m_stop || m_queued.load() > 0; });
+    if (m_stop)
+      return;
+  }
+}
+
+} // namespace AI
@@ -0,0 +1,98 @@
+#pragma once
+#include "Rng.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AI {
+
+/**
+ * @brief Fixed-size work-stealing thread pool.
+ *
+ * Every worker owns a task deque: it pops its newest task, and when the
+ * deque is empty it steals the oldest task of another worker. Tasks receive
+ * the index of the worker running them, which selects per-worker state (a
+ * strategy, statistics, workerRng()).
+ *
+ * submit()/parallelFor()/wait() are meant to be called from outside the
+ * pool; a task must not wait on the pool it runs in.
+ */
+class ThreadPool {
+public:
+  using Task = std::function<void(unsigned worker)>;
+
+  /**
+   * @param threads Worker count; 0 means std::thread::hardware_concurrency().
+   * @param seed Base seed of the per-worker random streams.
+   */
+  explicit ThreadPool(unsigned threads = 0, std::uint64_t seed = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Worker count (m_queues is complete before any worker starts)
+  [[nodiscard]] unsigned size() const {
+    return static_cast<unsigned>(m_queues.size());
+  }
+
+  // Queues a task (round-robin over the worker deques)
+  void submit(Task task);
+
+  /**
+   * @brief Blocks until every submitted task has finished.
+   * Rethrows the first exception thrown by a task, if any.
+   */
+  void wait();
+
+  /**
+   * @brief Runs fn(begin, end, worker) over [0, count) in chunks of `grain`
+   * and waits for completion. Which worker runs a chunk varies between
+   * runs; results should be keyed by index, not by worker.
+   */
+  void parallelFor(std::uint64_t count, std::uint64_t grain,
+                   const std::function<void(std::uint64_t, std::uint64_t,
+                                            unsigned)> &fn);
+
+  /**
+   * @brief Worker w's private random stream: Rng(seed) jumped w + 1 times,
+   * so streams never overlap. Only the task running on worker w may use it.
+   */
+  [[nodiscard]] Core::Rng &workerRng(unsigned worker) {
+    return m_queues[worker]->rng;
+  }
+
+private:
+  // One per worker, padded so that neighbouring locks do not share a line
+  struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    Core::Rng rng;
+  };
+
+  void workerLoop(unsigned worker);
+  bool popOwn(unsigned worker, Task &task);
+  bool steal(unsigned thief, Task &task);
+  void finishTask();
+
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_sleepMutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_idle;
+  std::atomic<std::uint64_t> m_queued{0};  // Tasks sitting in a deque
+  std::atomic<std::uint64_t> m_pending{0}; // Submitted, not yet finished
+  std::atomic<unsigned> m_nextQueue{0};
+  bool m_stop = false;
+  std::exception_ptr m_error;
+};
+
+} // namespace AI
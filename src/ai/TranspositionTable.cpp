@@ -0,0 +1,164 @@
+#include "TranspositionTable.hpp"
+#include <algorithm>
+#include <bit>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace AI {
+
+namespace {
+
+constexpr std::uint64_t VALID_BIT = std::uint64_t{1} << 40;
+constexpr std::size_t HUGE_PAGE_SIZE = std::size_t{2} << 20;
+
+std::uint64_t packData(int depth, float value) {
+  return std::bit_cast<std::uint32_t>(value) |
+         (static_cast<std::uint64_t>(depth & 0xFF) << 32) | VALID_BIT;
+}
+int depthOf(std::uint64_t data) { return static_cast<int>((data >> 32) & 0xFF); }
+float valueOf(std::uint64_t data) {
+  return std::bit_cast<float>(static_cast<std::uint32_t>(data));
+}
+
+} // namespace
+
+TranspositionTable::TranspositionTable(std::size_t entries, bool hugePages) {
+  m_bucketCount =
+      std::bit_floor(std::max<std::size_t>(entries / ENTRIES_PER_BUCKET, 1));
+  m_bytes = m_bucketCount * sizeof(Bucket);
+
+  void *memory = nullptr;
+#ifdef __linux__
+  if (hugePages) {
+    // Explicit huge pages first, then transparent huge pages
+    const std::size_t rounded =
+        (m_bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (memory != MAP_FAILED) {
+      m_hugePages = true;
+    } else {
+      memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (memory == MAP_FAILED)
+        throw std::bad_alloc();
+      m_hugePages = madvise(memory, rounded, MADV_HUGEPAGE) == 0;
+    }
+    m_bytes = rounded;
+    m_mapped = true;
+  }
+#else
+  (void)hugePages; // Huge pages are only wired up on Linux
+#endif
+  if (!memory)
+    memory = ::operator new(m_bytes, std::align_val_t{alignof(Bucket)});
+
+  m_buckets = static_cast<Bucket *>(memory);
+  for (std::size_t i = 0; i < m_bucketCount; ++i)
+    new (&m_buckets[i]) Bucket();
+  clear();
+}
+
+TranspositionTable::~TranspositionTable() {
+#ifdef __linux__
+  if (m_mapped) {
+    munmap(m_buckets, m_bytes);
+    return;
+  }
+#endif
+  ::operator delete(m_buckets, std::align_val_t{alignof(Bucket)});
+}
+
+TranspositionTable::CounterShard &
+TranspositionTable::shard(std::array<CounterShard, SHARDS> &shards) {
+  static std::atomic<unsigned> nextShard{0};
+  thread_local const unsigned index = nextShard.fetch_add(1) % SHARDS;
+  return shards[index];
+}
+
+bool TranspositionTable::probe(Core::Bitboard board, int depth, float &value) {
+  const std::uint64_t key = board.raw();
+  Bucket &bucket = bucketFor(key);
+  CounterShard &counters = shard(m_shards);
+
+  for (Entry &entry : bucket.entries) {
+    const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    const std::uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if ((data & VALID_BIT) && (check ^ data) == key && depthOf(data) >= depth) {
+      value = valueOf(data);
+      counters.hits.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  counters.misses.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void TranspositionTable::store(Core::Bitboard board, int depth, float value) {
+  const std::uint64_t key = board.raw();
+  Bucket &bucket = bucketFor(key);
+
+  // Same board, else an empty entry, else the shallowest one
+  Entry *target = nullptr;
+  int targetDepth = 256;
+  bool evicts = false;
+  for (Entry &entry : bucket.entries) {
+    const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    const std::uint64_t check = entry.check.load(std::memory_order_relaxed);
+    if (!(data & VALID_BIT)) {
+      if (targetDepth >= 0) {
+        target = &entry;
+        targetDepth = -1;
+        evicts = false;
+      }
+      continue;
+    }
+    if ((check ^ data) == key) {
+      if (depthOf(data) > depth)
+        return; // Keep the deeper result
+      target = &entry;
+      evicts = false;
+      break;
+    }
+    if (depthOf(data) < targetDepth) {
+      target = &entry;
+      targetDepth = depthOf(data);
+      evicts = true;
+    }
+  }
+
+  if (evicts)
+    shard(m_shards).collisions.fetch_add(1, std::memory_order_relaxed);
+  const std::uint64_t data = packData(depth, value);
+  target->data.store(data, std::memory_order_relaxed);
+  target->check.store(key ^ data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::clear() {
+  for (std::size_t i = 0; i < m_bucketCount; ++i) {
+    for (Entry &entry : m_buckets[i].entries) {
+      entry.check.store(0, std::memory_order_relaxed);
+      entry.data.store(0, std::memory_order_relaxed);
+    }
+  }
+  for (CounterShard &s : m_shards) {
+    s.hits.store(0, std::memory_order_relaxed);
+    s.misses.store(0, std::memory_order_relaxed);
+    s.collisions.store(0, std::memory_order_relaxed);
+  }
+}
+
+TranspositionTable::Stats TranspositionTable::stats() const {
+  Stats total;
+  for (const CounterShard &s : m_shards) {
+    total.hits += s.hits.load(std::memory_order_relaxed);
+    total.misses += s.misses.load(std::memory_order_relaxed);
+    total.collisions += s.collisions.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+} // namespace AI
@@ -0,0 +1,97 @@
+#pragma once
+#include "Bitboard.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace AI {
+
+/**
+ * @brief Fixed-size, lock-free cache of search values, shared by threads.
+ *
+ * Power-of-two number of 64-byte buckets, each holding four entries; a
+ * board hashes to one bucket and may occupy any of its entries (open
+ * addressing). Entries are two relaxed 64-bit atomics, {key ^ data, data}:
+ * a reader re-derives the key and rejects entries torn by a concurrent
+ * writer, so no locks are needed (the "lockless hashing" xor trick).
+ *
+ * A stored value is reused for a probe at the same or a smaller depth.
+ * When a bucket is full, the shallowest entry is replaced.
+ */
+class TranspositionTable {
+public:
+  static constexpr int ENTRIES_PER_BUCKET = 4;
+
+  struct Stats {
+    std::uint64_t hits = 0;       // Probe found the board at enough depth
+    std::uint64_t misses = 0;     // Probe found nothing usable
+    std::uint64_t collisions = 0; // Store evicted a different board
+  };
+
+  /**
+   * @param entries Capacity, rounded down to a power of two (at least one
+   *        bucket).
+   * @param hugePages Back the table with huge pages when the OS allows it
+   *        (Linux: MAP_HUGETLB, else transparent huge pages via madvise).
+   * @throws std::bad_alloc if the memory cannot be allocated.
+   */
+  explicit TranspositionTable(std::size_t entries, bool hugePages = false);
+  ~TranspositionTable();
+
+  TranspositionTable(const TranspositionTable &) = delete;
+  TranspositionTable &operator=(const TranspositionTable &) = delete;
+
+  /**
+   * @brief Looks up `board` searched to at least `depth`.
+   * @return True and sets `value` on a hit.
+   */
+  bool probe(Core::Bitboard board, int depth, float &value);
+
+  // Records the value of `board` searched to `depth` (0-255)
+  void store(Core::Bitboard board, int depth, float value);
+
+  // Empties every entry and resets the counters (not thread-safe)
+  void clear();
+
+  [[nodiscard]] std::size_t capacity() const {
+    return m_bucketCount * ENTRIES_PER_BUCKET;
+  }
+  [[nodiscard]] std::size_t sizeBytes() const { return m_bytes; }
+  [[nodiscard]] bool usesHugePages() const { return m_hugePages; }
+
+  // Summed over all threads
+  [[nodiscard]] Stats stats() const;
+
+private:
+  struct Entry {
+    std::atomic<std::uint64_t> check; // key ^ data
+    std::atomic<std::uint64_t> data;  // value bits | depth << 32 | valid bit
+  };
+  struct alignas(64) Bucket {
+    Entry entries[ENTRIES_PER_BUCKET];
+  };
+  static_assert(sizeof(Bucket) == 64);
+
+  // Per-thread counter shards, so that threads do not fight over one line
+  struct alignas(64) CounterShard {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> collisions{0};
+  };
+  static constexpr int SHARDS = 16;
+
+  [[nodiscard]] Bucket &bucketFor(std::uint64_t key) const {
+    return m_buckets[Core::Bitboard(key).hash() & (m_bucketCount - 1)];
+  }
+  static CounterShard &shard(std::array<CounterShard, SHARDS> &shards);
+
+  Bucket *m_buckets = nullptr;
+  std::size_t m_bucketCount = 0;
+  std::size_t m_bytes = 0;
+  bool m_hugePages = false;
+  bool m_mapped = false; // Allocated with mmap (else operator new)
+  std::array<CounterShard, SHARDS> m_shards;
+};
+
+} // namespace AI
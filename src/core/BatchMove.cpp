@@ -0,0 +1,263 @@
+#include "BatchMove.hpp"
+#include "Bitboard.hpp"
+#include "MoveTables.hpp"
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define TILETWISTER_BATCH_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace Core {
+
+// The gathers read an entry as two 32-bit words: (row | targets | merges)
+// and score
+static_assert(sizeof(RowMoveEntry) == 8);
+
+namespace {
+
+bool isVertical(Direction dir) {
+  return dir == Direction::Up || dir == Direction::Down;
+}
+
+// Columns become rows of the transposed board: Up = Left, Down = Right
+const RowMoveEntry *tableFor(Direction dir) {
+  const MoveTables &tables = MoveTables::instance();
+  return (dir == Direction::Left || dir == Direction::Up) ? tables.leftData()
+                                                          : tables.rightData();
+}
+
+void applyScalar(const std::uint64_t *boards, std::size_t count,
+                 Direction dir, const BatchMoveOutput &out) {
+  for (std::size_t i = 0; i < count; ++i) {
+    const BitboardMove result = Bitboard(boards[i]).move(dir);
+    out.boards[i] = result.board.raw();
+    out.scores[i] = static_cast<std::uint32_t>(result.score);
+    out.moved[i] = result.moved ? 1 : 0;
+  }
+}
+
+#ifdef TILETWISTER_BATCH_X86
+
+// Bitboard::transposed() on every 64-bit lane
+__attribute__((target("sse4.1"))) __m128i transpose128(__m128i x) {
+  const __m128i a1 = _mm_and_si128(x, _mm_set1_epi64x(0xF0F00F0FF0F00F0FLL));
+  const __m128i a2 = _mm_and_si128(x, _mm_set1_epi64x(0x0000F0F00000F0F0LL));
+  const __m128i a3 = _mm_and_si128(x, _mm_set1_epi64x(0x0F0F00000F0F0000LL));
+  const __m128i a = _mm_or_si128(
+      a1, _mm_or_si128(_mm_slli_epi64(a2, 12), _mm_srli_epi64(a3, 12)));
+  const __m128i b1 = _mm_and_si128(a, _mm_set1_epi64x(0xFF00FF0000FF00FFLL));
+  const __m128i b2 = _mm_and_si128(a, _mm_set1_epi64x(0x00FF00FF00000000LL));
+  const __m128i b3 = _mm_and_si128(a, _mm_set1_epi64x(0x00000000FF00FF00LL));
+  return _mm_or_si128(
+      b1, _mm_or_si128(_mm_srli_epi64(b2, 24), _mm_slli_epi64(b3, 24)));
+}
+
+__attribute__((target("avx2"))) __m256i transpose256(__m256i x) {
+  const __m256i a1 =
+      _mm256_and_si256(x, _mm256_set1_epi64x(0xF0F00F0FF0F00F0FLL));
+  const __m256i a2 =
+      _mm256_and_si256(x, _mm256_set1_epi64x(0x0000F0F00000F0F0LL));
+  const __m256i a3 =
+      _mm256_and_si256(x, _mm256_set1_epi64x(0x0F0F00000F0F0000LL));
+  const __m256i a = _mm256_or_si256(
+      a1, _mm256_or_si256(_mm256_slli_epi64(a2, 12), _mm256_srli_epi64(a3, 12)));
+  const __m256i b1 =
+      _mm256_and_si256(a, _mm256_set1_epi64x(0xFF00FF0000FF00FFLL));
+  const __m256i b2 =
+      _mm256_and_si256(a, _mm256_set1_epi64x(0x00FF00FF00000000LL));
+  const __m256i b3 =
+      _mm256_and_si256(a, _mm256_set1_epi64x(0x00000000FF00FF00LL));
+  return _mm256_or_si256(
+      b1, _mm256_or_si256(_mm256_srli_epi64(b2, 24), _mm256_slli_epi64(b3, 24)));
+}
+
+// Looks up the eight packed rows of two boards. The rows stay in the vector
+// register (extract/insert), which avoids a store-to-load stall.
+__attribute__((target("sse4.1"))) inline __m128i
+lookupRows(const RowMoveEntry *table, __m128i rows, std::uint32_t score[2]) {
+  __m128i result = _mm_setzero_si128();
+#define TILETWISTER_SSE_ROW(r)                                                 \
+  {                                                                            \
+    const RowMoveEntry &entry =                                                \
+        table[static_cast<std::uint16_t>(_mm_extract_epi16(rows, r))];         \
+    result = _mm_insert_epi16(result, entry.row, r);                           \
+    score[(r) >> 2] += entry.score;                                            \
+  }
+  TILETWISTER_SSE_ROW(0)
+  TILETWISTER_SSE_ROW(1)
+  TILETWISTER_SSE_ROW(2)
+  TILETWISTER_SSE_ROW(3)
+  TILETWISTER_SSE_ROW(4)
+  TILETWISTER_SSE_ROW(5)
+  TILETWISTER_SSE_ROW(6)
+  TILETWISTER_SSE_ROW(7)
+#undef TILETWISTER_SSE_ROW
+  return result;
+}
+
+// Two boards per step: SIMD transpose and compare, per-row table lookups
+__attribute__((target("sse4.1"))) void
+applySse41(const std::uint64_t *boards, std::size_t count, Direction dir,
+           const BatchMoveOutput &out) {
+  const RowMoveEntry *table = tableFor(dir);
+  const bool vertical = isVertical(dir);
+
+  std::size_t i = 0;
+  for (; i + 2 <= count; i += 2) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(boards + i));
+    const __m128i rows = vertical ? transpose128(in) : in;
+
+    std::uint32_t score[2] = {0, 0};
+    __m128i result = lookupRows(table, rows, score);
+
+    if (vertical)
+      result = transpose128(result);
+    const int same = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(in, result)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out.boards + i), result);
+    out.scores[i] = score[0];
+    out.scores[i + 1] = score[1];
+    out.moved[i] = (same & 1) ? 0 : 1;
+    out.moved[i + 1] = (same & 2) ? 0 : 1;
+  }
+  applyScalar(boards + i, count - i, dir,
+              {out.boards + i, out.scores + i, out.moved + i});
+}
+
+// Four boards per step: all 16 rows are looked up with four 8-wide gathers
+__attribute__((target("avx2"))) void
+applyAvx2(const std::uint64_t *boards, std::size_t count, Direction dir,
+          const BatchMoveOutput &out) {
+  const int *table = reinterpret_cast<const int *>(tableFor(dir));
+  const bool vertical = isVertical(dir);
+  const __m256i rowMask = _mm256_set1_epi32(0xFFFF);
+
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256i in =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(boards + i));
+    const __m256i rows = vertical ? transpose256(in) : in;
+
+    // Rows of boards i, i+1 | i+2, i+3 widened to 32-bit table indices
+    const __m256i idxLo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(rows));
+    const __m256i idxHi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(rows, 1));
+
+    // Word 0 of an entry holds the resulting row, word 1 the score
+    const __m256i rowLo =
+        _mm256_and_si256(_mm256_i32gather_epi32(table, idxLo, 8), rowMask);
+    const __m256i rowHi =
+        _mm256_and_si256(_mm256_i32gather_epi32(table, idxHi, 8), rowMask);
+    const __m256i scoreLo = _mm256_i32gather_epi32(table + 1, idxLo, 8);
+    const __m256i scoreHi = _mm256_i32gather_epi32(table + 1, idxHi, 8);
+
+    // packus interleaves 128-bit lanes; restore board order
+    __m256i result = _mm256_permute4x64_epi64(_mm256_packus_epi32(rowLo, rowHi),
+                                              _MM_SHUFFLE(3, 1, 2, 0));
+    if (vertical)
+      result = transpose256(result);
+
+    // Two horizontal adds leave board sums at 32-bit slots 0, 4, 1, 5
+    __m256i sums = _mm256_hadd_epi32(scoreLo, scoreHi);
+    sums = _mm256_hadd_epi32(sums, sums);
+    alignas(32) std::uint32_t score[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(score), sums);
+
+    const int same =
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(in, result)));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out.boards + i), result);
+    out.scores[i] = score[0];
+    out.scores[i + 1] = score[4];
+    out.scores[i + 2] = score[1];
+    out.scores[i + 3] = score[5];
+    for (int b = 0; b < 4; ++b)
+      out.moved[i + b] = ((same >> b) & 1) ? 0 : 1;
+  }
+  applyScalar(boards + i, count - i, dir,
+              {out.boards + i, out.scores + i, out.moved + i});
+}
+
+
+#endif // TILETWISTER_BATCH_X86
+
+SimdLevel bestSupported() {
+#ifdef TILETWISTER_BATCH_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return SimdLevel::AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return SimdLevel::SSE41;
+#endif
+  return SimdLevel::Scalar;
+}
+
+#ifdef TILETWISTER_BATCH_X86
+// AMD CPU family as /proc/cpuinfo shows it (base + extended), 0 otherwise
+unsigned amdFamily() {
+  unsigned eax, ebx, ecx, edx;
+  if (!__builtin_cpu_is("amd") || !__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    return 0;
+  const unsigned base = (eax >> 8) & 0xF;
+  return base == 0xF ? base + ((eax >> 20) & 0xFF) : base;
+}
+#endif
+
+// Kernel used by the default apply(): the widest one, except on CPU
+// families where BM_BatchMove measured SSE4.1 ahead of AVX2. Zen 5
+// (family 1Ah): SSE4.1 541 M boards/s, AVX2 370 M boards/s.
+SimdLevel preferred() {
+  const SimdLevel best = bestSupported();
+#ifdef TILETWISTER_BATCH_X86
+  if (best == SimdLevel::AVX2 && amdFamily() == 0x1A)
+    return SimdLevel::SSE41;
+#endif
+  return best;
+}
+
+} // namespace
+
+SimdLevel BatchMove::detectedLevel() {
+  static const SimdLevel level = bestSupported();
+  return level;
+}
+
+SimdLevel BatchMove::preferredLevel() {
+  static const SimdLevel level = preferred();
+  return level;
+}
+
+bool BatchMove::isSupported(SimdLevel level) {
+  return static_cast<int>(level) <= static_cast<int>(detectedLevel());
+}
+
+void BatchMove::apply(const std::uint64_t *boards, std::size_t count,
+                      Direction dir, const BatchMoveOutput &out) {
+  apply(preferredLevel(), boards, count, dir, out);
+}
+
+void BatchMove::apply(SimdLevel level, const std::uint64_t *boards,
+                      std::size_t count, Direction dir,
+                      const BatchMoveOutput &out) {
+  if (!isSupported(level))
+    throw std::invalid_argument("BatchMove: SIMD level not supported by CPU");
+
+  switch (level) {
+#ifdef TILETWISTER_BATCH_X86
+  case SimdLevel::AVX2:
+    applyAvx2(boards, count, dir, out);
+    return;
+  case SimdLevel::SSE41:
+    applySse41(boards, count, dir, out);
+    return;
+#endif
+  default:
+    applyScalar(boards, count, dir, out);
+    return;
+  }
+}
+
+} // namespace Core
@@ -0,0 +1,53 @@
+#pragma once
+#include "GameLogic.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Core {
+
+// Instruction set used by a BatchMove kernel
+enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+/**
+ * @brief Structure-of-arrays destination of a batched move.
+ *
+ * Each pointer must address at least `count` elements. `boards` may alias the
+ * input array to move in place.
+ */
+struct BatchMoveOutput {
+  std::uint64_t *boards; // Resulting packed boards (Bitboard::raw() layout)
+  std::uint32_t *scores; // Points gained by each board
+  std::uint8_t *moved;   // 1 if the board changed, else 0
+};
+
+/**
+ * @brief Applies one direction to many packed boards at once.
+ *
+ * Same rules as Bitboard::move. The kernel is picked at runtime: AVX2 (4
+ * boards per step, table lookups via gathers), SSE4.1 (2 boards per step,
+ * vector transpose/compare with per-row lookups) or a portable scalar loop.
+ * SIMD kernels are only built for x86 with GCC/Clang.
+ */
+class BatchMove {
+public:
+  // Widest kernel supported by this CPU (detected once)
+  [[nodiscard]] static SimdLevel detectedLevel();
+  // Kernel apply() uses: detectedLevel(), except SSE4.1 on CPU families
+  // where it measured faster than AVX2 (AMD Zen 5). The apply() overload
+  // taking a level overrides it.
+  [[nodiscard]] static SimdLevel preferredLevel();
+  [[nodiscard]] static bool isSupported(SimdLevel level);
+
+  static void apply(const std::uint64_t *boards, std::size_t count,
+                    Direction dir, const BatchMoveOutput &out);
+
+  /**
+   * @brief Same, forcing a specific kernel (tests / benchmarks).
+   * @throws std::invalid_argument if the CPU does not support it.
+   */
+  static void apply(SimdLevel level, const std::uint64_t *boards,
+                    std::size_t count, Direction dir,
+                    const BatchMoveOutput &out);
+};
+
+} // namespace Core
@@ -0,0 +1,177 @@
+#include "Bitboard.hpp"
+#include "MoveTables.hpp"
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+namespace Core {
+
+namespace {
+
+// Looks up all four rows in one direction's table.
+template <typename Lookup>
+std::uint64_t mapRows(std::uint64_t bits, int &score, Lookup lookup) {
+  std::uint64_t out = 0;
+  for (int y = 0; y < 4; ++y) {
+    const RowMoveEntry &entry =
+        lookup(static_cast<std::uint16_t>(bits >> (16 * y)));
+    out |= static_cast<std::uint64_t>(entry.row) << (16 * y);
+    score += static_cast<int>(entry.score);
+  }
+  return out;
+}
+
+} // namespace
+
+Bitboard Bitboard::fromGrid(const Grid &grid) {
+  Bitboard board;
+  for (int y = 0; y < SIZE; ++y) {
+    for (int x = 0; x < SIZE; ++x) {
+      const int e = grid.getExponent(x, y);
+      if (e > MAX_EXPONENT) {
+        throw std::invalid_argument("Bitboard cannot represent tile value " +
+                                    std::to_string(grid.getTile(x, y).getValue()));
+      }
+      board.setExponent(x, y, e);
+    }
+  }
+  return board;
+}
+
+void Bitboard::toGrid(Grid &grid) const {
+  for (int y = 0; y < SIZE; ++y) {
+    for (int x = 0; x < SIZE; ++x) {
+      grid.setExponent(x, y, getExponent(x, y));
+    }
+  }
+  grid.clearMergedFlags();
+}
+
+std::uint16_t Bitboard::getColumn(int x) const {
+  return transposed().getRow(x);
+}
+
+std::uint16_t Bitboard::emptyMask() const {
+  // Fold each nibble to its low bit: set if any bit of the nibble is set
+  std::uint64_t occupied = bits | (bits >> 1);
+  occupied |= occupied >> 2;
+  occupied &= 0x1111111111111111ULL;
+
+  std::uint16_t mask = 0;
+  for (int i = 0; i < 16; ++i) {
+    if (!((occupied >> (4 * i)) & 1))
+      mask |= static_cast<std::uint16_t>(1u << i);
+  }
+  return mask;
+}
+
+int Bitboard::countEmpty() const { return std::popcount(emptyMask()); }
+
+int Bitboard::maxExponent() const {
+  int best = 0;
+  for (int i = 0; i < 16; ++i) {
+    const int e = static_cast<int>((bits >> (4 * i)) & 0xF);
+    if (e > best)
+      best = e;
+  }
+  return best;
+}
+
+Bitboard Bitboard::transposed() const {
+  // Three masked swaps move each nibble (r, c) to (c, r)
+  const std::uint64_t x = bits;
+  const std::uint64_t a1 = x & 0xF0F00F0FF0F00F0FULL;
+  const std::uint64_t a2 = x & 0x0000F0F00000F0F0ULL;
+  const std::uint64_t a3 = x & 0x0F0F00000F0F0000ULL;
+  const std::uint64_t a = a1 | (a2 << 12) | (a3 >> 12);
+  const std::uint64_t b1 = a & 0xFF00FF0000FF00FFULL;
+  const std::uint64_t b2 = a & 0x00FF00FF00000000ULL;
+  const std::uint64_t b3 = a & 0x00000000FF00FF00ULL;
+  return Bitboard(b1 | (b2 >> 24) | (b3 << 24));
+}
+
+BitboardMove Bitboard::move(Direction dir) const {
+  const MoveTables &tables = MoveTables::instance();
+  auto left = [&tables](std::uint16_t row) -> const RowMoveEntry & {
+    return tables.left(row);
+  };
+  auto right = [&tables](std::uint16_t row) -> const RowMoveEntry & {
+    return tables.right(row);
+  };
+
+  int score = 0;
+  std::uint64_t result = 0;
+
+  // Columns are handled as rows of the transposed board, where cell 0 is the
+  // top of the column.
+  switch (dir) {
+  case Direction::Left:
+    result = mapRows(bits, score, left);
+    break;
+  case Direction::Right:
+    result = mapRows(bits, score, right);
+    break;
+  case Direction::Up:
+    result = Bitboard(mapRows(transposed().bits, score, left)).transposed().bits;
+    break;
+  case Direction::Down:
+    result =
+        Bitboard(mapRows(transposed().bits, score, right)).transposed().bits;
+    break;
+  }
+
+  return {Bitboard(result), score, result != bits};
+}
+
+std::uint8_t Bitboard::legalMoves() const {
+  // A row can move when its table entry differs from itself; the resulting
+  // boards are never built
+  const MoveTables &tables = MoveTables::instance();
+  const std::uint64_t columns = transposed().bits;
+  bool left = false, right = false, up = false, down = false;
+  for (int i = 0; i < 4; ++i) {
+    const auto row = static_cast<std::uint16_t>(bits >> (16 * i));
+    const auto col = static_cast<std::uint16_t>(columns >> (16 * i));
+    left |= tables.left(row).row != row;
+    right |= tables.right(row).row != row;
+    up |= tables.left(col).row != col;
+    down |= tables.right(col).row != col;
+  }
+
+  std::uint8_t mask = 0;
+  if (left)
+    mask |= GameLogic::directionBit(Direction::Left);
+  if (right)
+    mask |= GameLogic::directionBit(Direction::Right);
+  if (up)
+    mask |= GameLogic::directionBit(Direction::Up);
+  if (down)
+    mask |= GameLogic::directionBit(Direction::Down);
+  return mask;
+}
+
+bool Bitboard::isGameOver() const { return legalMoves() == 0; }
+
+Bitboard Bitboard::spawnRandom(Rng &rng, const SpawnDistribution &spawns) const {
+  std::uint16_t empty = emptyMask();
+  if (empty == 0)
+    return *this;
+
+  // Same draws as Grid::spawnRandomTile: cell first, then the tile
+  auto k = rng.nextBelow(static_cast<std::uint32_t>(std::popcount(empty)));
+  for (; k > 0; --k)
+    empty &= static_cast<std::uint16_t>(empty - 1);
+  const int shift = 4 * std::countr_zero(empty);
+  return Bitboard(bits | (static_cast<std::uint64_t>(spawns.sampleExponent(rng))
+                          << shift));
+}
+
+std::uint64_t Bitboard::hash() const {
+  // SplitMix64 finalizer
+  std::uint64_t z = bits + 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+} // namespace Core
@@ -0,0 +1,162 @@
+#pragma once
+#include "GameLogic.hpp"
+#include "Grid.hpp"
+#include "Rng.hpp"
+#include "SpawnDistribution.hpp"
+#include <bit>
+#include <cstdint>
+#include <functional>
+
+namespace Core {
+
+struct BitboardMove;
+
+/**
+ * @brief Packed 4x4 board: one 4-bit exponent per cell in a single uint64_t.
+ *
+ * Cell (x, y) lives in nibble (y * 4 + x), so row y occupies bits
+ * [16y, 16y + 16) with column 0 in the lowest nibble. An exponent of 0 is an
+ * empty cell, otherwise the tile value is (1 << exponent).
+ *
+ * Intended for simulations and search: it is trivially copyable, 8 bytes,
+ * hashable, and never touches the heap. Core::Grid remains the authoritative
+ * board for the game itself.
+ *
+ * Limitation: the largest representable tile is 32768 (exponent 15). Two
+ * adjacent 32768 tiles do not merge in the packed representation because the
+ * result (65536) would not fit in a nibble.
+ */
+class Bitboard {
+public:
+  static constexpr int SIZE = 4;
+  static constexpr int MAX_EXPONENT = 15;
+
+  constexpr Bitboard() = default;
+  constexpr explicit Bitboard(std::uint64_t raw) : bits(raw) {}
+
+  /**
+   * @brief Packs a Grid. Merge flags are not carried over.
+   * @throws std::invalid_argument if a tile is not 0 or a power of two in
+   *         [2, 32768].
+   */
+  [[nodiscard]] static Bitboard fromGrid(const Grid &grid);
+
+  // Writes every cell back into the grid (merge flags are cleared).
+  void toGrid(Grid &grid) const;
+
+  [[nodiscard]] constexpr std::uint64_t raw() const { return bits; }
+
+  // Cell Access (x = column, y = row)
+  [[nodiscard]] constexpr int getExponent(int x, int y) const {
+    return static_cast<int>((bits >> shiftOf(x, y)) & 0xF);
+  }
+  constexpr void setExponent(int x, int y, int exponent) {
+    const int shift = shiftOf(x, y);
+    bits = (bits & ~(std::uint64_t{0xF} << shift)) |
+           (static_cast<std::uint64_t>(exponent & 0xF) << shift);
+  }
+  [[nodiscard]] constexpr int getValue(int x, int y) const {
+    const int e = getExponent(x, y);
+    return e == 0 ? 0 : 1 << e;
+  }
+
+  // Packed row y / column x, cell 0 in the lowest nibble.
+  [[nodiscard]] constexpr std::uint16_t getRow(int y) const {
+    return static_cast<std::uint16_t>(bits >> (16 * y));
+  }
+  [[nodiscard]] std::uint16_t getColumn(int x) const;
+
+  // Bit i is set when cell i (= y * 4 + x) is empty.
+  [[nodiscard]] std::uint16_t emptyMask() const;
+  [[nodiscard]] int countEmpty() const;
+  [[nodiscard]] int maxExponent() const;
+
+  // Board with rows and columns swapped.
+  [[nodiscard]] Bitboard transposed() const;
+
+  // Board with the cells of every row reversed (left-right mirror).
+  [[nodiscard]] constexpr Bitboard mirrored() const {
+    return Bitboard(((bits & 0x000F000F000F000FULL) << 12) |
+                    ((bits & 0x00F000F000F000F0ULL) << 4) |
+                    ((bits >> 4) & 0x00F000F000F000F0ULL) |
+                    ((bits >> 12) & 0x000F000F000F000FULL));
+  }
+
+  // Board with the order of the rows reversed (top-bottom flip).
+  [[nodiscard]] constexpr Bitboard flipped() const {
+    return Bitboard((bits << 48) | ((bits & 0xFFFF0000ULL) << 16) |
+                    ((bits >> 16) & 0xFFFF0000ULL) | (bits >> 48));
+  }
+
+  /**
+   * @brief Applies a move and returns the resulting board.
+   * Same rules as GameLogic::move (no spawn, leftmost pairs merge first).
+   */
+  [[nodiscard]] BitboardMove move(Direction dir) const;
+
+  // Directions that change the board, as GameLogic::directionBit() flags.
+  [[nodiscard]] std::uint8_t legalMoves() const;
+
+  // True when no direction changes the board.
+  [[nodiscard]] bool isGameOver() const;
+
+  /**
+   * @brief Board with a tile spawned in a random empty cell (unchanged if
+   * full). Same draws as Grid::spawnRandomTile, so a seed gives the same
+   * game on either representation.
+   */
+  [[nodiscard]] Bitboard
+  spawnRandom(Rng &rng,
+              const SpawnDistribution &spawns = SpawnDistribution::classic()) const;
+
+  /**
+   * @brief Calls fn(board, probability) for every possible spawn: each
+   * empty cell (ascending) with each outcome of `spawns` (in order).
+   * Probabilities sum to 1 unless the board is full (then fn is not
+   * called). Inline and allocation-free, for search chance nodes.
+   */
+  template <typename Fn>
+  void forEachSpawn(const SpawnDistribution &spawns, Fn &&fn) const {
+    const std::uint16_t empty = emptyMask();
+    if (empty == 0)
+      return;
+    const double perCell = 1.0 / std::popcount(empty);
+    for (std::uint16_t cells = empty; cells; cells &= cells - 1) {
+      const int shift = 4 * std::countr_zero(cells);
+      for (int i = 0; i < spawns.size(); ++i) {
+        fn(Bitboard(bits | (static_cast<std::uint64_t>(
+                                spawns.outcome(i).exponent) << shift)),
+           spawns.probability(i) * perCell);
+      }
+    }
+  }
+
+  // Well-mixed 64-bit hash of the packed board.
+  [[nodiscard]] std::uint64_t hash() const;
+
+  friend constexpr bool operator==(Bitboard a, Bitboard b) {
+    return a.bits == b.bits;
+  }
+
+private:
+  static constexpr int shiftOf(int x, int y) { return 4 * (y * SIZE + x); }
+
+  std::uint64_t bits = 0;
+};
+
+/**
+ * @brief Outcome of a move applied to a Bitboard.
+ */
+struct BitboardMove {
+  Bitboard board; // Resulting board (unchanged if !moved)
+  int score;      // Points gained by merges
+  bool moved;
+};
+
+} // namespace Core
+
+template <> struct std::hash<Core::Bitboard> {
+  std::size_t operator()(Core::Bitboard board) const noexcept {
+    return static_cast<std::size_t>(board.hash());
+  }
+};
@@ -1,21 +1,210 @@
 #include "GameLogic.hpp"
-#include <algorithm> // For std::reverse
-#include <tuple>
+#include "MoveTables.hpp"
 #include <vector>
 
 namespace Core {
 
 GameLogic::MoveResult GameLogic::move(Grid &grid, Direction dir) {
+  MoveEventBuffer buffer;
+  MoveSummary summary = move(grid, dir, buffer);
+  return {summary.moved, summary.score,
+          std::vector<MoveEvent>(buffer.begin(), buffer.end())};
+}
+
+// Records every row move as a global MoveEvent
+struct GameLogic::RecordEvents {
+  static constexpr bool ENABLED = true;
+  MoveEventBuffer &events;
+
+  // Convert a local row move (slide-left coordinates) to a global MoveEvent
+  void record(const RowMove &rm, int ly, Direction dir) {
+    MoveEvent evt;
+    evt.type = rm.isMerge ? MoveEvent::Type::Merge : MoveEvent::Type::Slide;
+    evt.value = rm.value; // Value of the moving tile (pre-merge)
+    evt.mergedValue = rm.isMerge ? rm.value * 2 : 0;
+
+    int lx1 = rm.fromIndex;
+    int lx2 = rm.toIndex;
+
+    // Map Local -> Global
+    switch (dir) {
+    case Direction::Left:
+      evt.fromX = lx1;
+      evt.fromY = ly;
+      evt.toX = lx2;
+      evt.toY = ly;
+      break;
+    case Direction::Right:
+      evt.fromX = 3 - lx1;
+      evt.fromY = ly;
+      evt.toX = 3 - lx2;
+      evt.toY = ly;
+      break;
+    case Direction::Up:
+      evt.fromX = ly;
+      evt.fromY = lx1;
+      evt.toX = ly;
+      evt.toY = lx2;
+      break;
+    case Direction::Down:
+      evt.fromX = ly;
+      evt.fromY = 3 - lx1;
+      evt.toX = ly;
+      evt.toY = 3 - lx2;
+      break;
+    }
+    events.push(evt);
+  }
+};
+
+// Fast mode: the compiler drops all event bookkeeping
+struct GameLogic::SkipEvents {
+  static constexpr bool ENABLED = false;
+  void record(const RowMove &, int, Direction) {}
+};
+
+namespace {
+
+// Grid column of position i along lane `lane` for a move in Dir.
+// Position 0 is the edge the tiles slide towards, so every direction is a
+// slide-left in lane coordinates.
+template <Direction Dir> constexpr int laneX(int lane, int i) {
+  if constexpr (Dir == Direction::Left)
+    return i;
+  else if constexpr (Dir == Direction::Right)
+    return 3 - i;
+  else
+    return lane;
+}
+
+// Grid row of position i along lane `lane` for a move in Dir
+template <Direction Dir> constexpr int laneY(int lane, int i) {
+  if constexpr (Dir == Direction::Up)
+    return i;
+  else if constexpr (Dir == Direction::Down)
+    return 3 - i;
+  else
+    return lane;
+}
+
+} // namespace
+
+template <Direction Dir>
+bool GameLogic::packLane(const Grid &grid, int lane, std::uint16_t &packed) {
+  packed = 0;
+  for (int i = 0; i < 4; ++i) {
+    const int e = grid.getExponent(laneX<Dir>(lane, i), laneY<Dir>(lane, i));
+    if (e >= 15) // 32768+ tiles are outside the table domain
+      return false;
+    packed |= static_cast<std::uint16_t>(e << (4 * i));
+  }
+  return true;
+}
+
+template <Direction Dir, typename EventPolicy>
+GameLogic::MoveSummary GameLogic::moveKernel(Grid &grid,
+                                             EventPolicy &policy) {
   // Pre-move: Reset merge flags
-  for (int y = 0; y < 4; ++y) {
-    for (int x = 0; x < 4; ++x) {
-      grid.getTile(x, y).resetMerged();
+  grid.clearMergedFlags();
+
+  bool changed = false;
+  int totalScore = 0;
+
+  // Each lane is read and written in place with strided indices, so no
+  // direction needs a transpose/reverse pass
+  const MoveTables &tables = MoveTables::instance();
+  for (int lane = 0; lane < 4; ++lane) {
+    std::uint16_t packed = 0;
+    if (!packLane<Dir>(grid, lane, packed)) {
+      // Tiles too large for the tables: reference row routine
+      std::array<Tile, 4> tempRow;
+      for (int i = 0; i < 4; ++i)
+        tempRow[i] = grid.getTile(laneX<Dir>(lane, i), laneY<Dir>(lane, i));
+
+      RowResult row = slideAndMergeRow(tempRow);
+      if (row.changed) {
+        changed = true;
+        totalScore += row.score;
+        for (int i = 0; i < 4; ++i)
+          grid.getTile(laneX<Dir>(lane, i), laneY<Dir>(lane, i)) = tempRow[i];
+        if constexpr (EventPolicy::ENABLED) {
+          for (int m = 0; m < row.moveCount; ++m)
+            policy.record(row.moves[m], lane, Dir);
+        }
+      }
+      continue;
+    }
+
+    const RowMoveEntry &entry = tables.left(packed);
+    if (entry.row == packed)
+      continue;
+
+    changed = true;
+    totalScore += static_cast<int>(entry.score);
+    for (int i = 0; i < 4; ++i) {
+      grid.setExponent(laneX<Dir>(lane, i), laneY<Dir>(lane, i),
+                       (entry.row >> (4 * i)) & 0xF);
+    }
+
+    // Only tiles that changed cell (or merged) produce events
+    for (int i = 0; i < 4; ++i) {
+      const int e = (packed >> (4 * i)) & 0xF;
+      if (e == 0)
+        continue;
+      const int dest = entry.targetOf(i);
+      const bool merged = entry.mergedFrom(i);
+      if (merged)
+        grid.getTile(laneX<Dir>(lane, dest), laneY<Dir>(lane, dest))
+            .setMerged(true);
+      if constexpr (EventPolicy::ENABLED) {
+        if (merged || dest != i)
+          policy.record({i, dest, merged, 1 << e}, lane, Dir);
+      }
     }
   }
 
+  // Add Spawn Event if moved logic is handled by caller?
+  // Usually Game adds a tile if moved. Game should generate the Spawn Event
+  // manually after this.
+
+  return {changed, totalScore};
+}
+
+template <typename EventPolicy>
+GameLogic::MoveSummary GameLogic::moveImpl(Grid &grid, Direction dir,
+                                           EventPolicy &policy) {
+  switch (dir) {
+  case Direction::Up:
+    return moveKernel<Direction::Up>(grid, policy);
+  case Direction::Down:
+    return moveKernel<Direction::Down>(grid, policy);
+  case Direction::Left:
+    return moveKernel<Direction::Left>(grid, policy);
+  case Direction::Right:
+    return moveKernel<Direction::Right>(grid, policy);
+  }
+  return {false, 0};
+}
+
+GameLogic::MoveSummary GameLogic::move(Grid &grid, Direction dir,
+                                       MoveEventBuffer &events) {
+  events.clear();
+  RecordEvents policy{events};
+  return moveImpl(grid, dir, policy);
+}
+
+GameLogic::MoveSummary GameLogic::moveFast(Grid &grid, Direction dir) {
+  SkipEvents policy;
+  return moveImpl(grid, dir, policy);
+}
+
+GameLogic::MoveResult GameLogic::moveReference(Grid &grid, Direction dir) {
+  MoveEventBuffer events;
+  RecordEvents policy{events};
+  grid.clearMergedFlags();
+
   bool changed = false;
   int totalScore = 0;
-  std::vector<MoveEvent> events;
 
   // 1. Transform Grid
   switch (dir) {
@@ -39,58 +228,14 @@ GameLogic::MoveResult GameLogic::move(Grid &grid, Direction dir) {
     for (int x = 0; x < 4; ++x)
       tempRow[x] = grid.getTile(x, y);
 
-    auto [rowChanged, rowScore, rowMoves] = slideAndMergeRow(tempRow);
-
-    if (rowChanged) {
+    RowResult row = slideAndMergeRow(tempRow);
+    if (row.changed) {
       changed = true;
-      totalScore += rowScore;
+      totalScore += row.score;
       for (int x = 0; x < 4; ++x)
         grid.getTile(x, y) = tempRow[x];
-
-      // Convert RowMoves to Global MoveEvents
-      for (const auto &rm : rowMoves) {
-        MoveEvent evt;
-        evt.type = rm.isMerge ? MoveEvent::Type::Merge : MoveEvent::Type::Slide;
-        evt.value = rm.value;
-        evt.mergedValue =
-            rm.isMerge ? rm.value * 2 : 0; // If merge, value is PRE-merge
-                                           // value? Or post? logic below
-        // Actually slideAndMergeRow returns 'value' in Move?
-        // Let's verify semantics: rowMove.value = The tile value moving.
-
-        int lx1 = rm.fromIndex;
-        int lx2 = rm.toIndex;
-        int ly = y;
-
-        // Map Local -> Global
-        switch (dir) {
-        case Direction::Left:
-          evt.fromX = lx1;
-          evt.fromY = ly;
-          evt.toX = lx2;
-          evt.toY = ly;
-          break;
-        case Direction::Right:
-          evt.fromX = 3 - lx1;
-          evt.fromY = ly;
-          evt.toX = 3 - lx2;
-          evt.toY = ly;
-          break;
-        case Direction::Up:
-          evt.fromX = ly;
-          evt.fromY = lx1;
-          evt.toX = ly;
-          evt.toY = lx2;
-          break;
-        case Direction::Down:
-          evt.fromX = ly;
-          evt.fromY = 3 - lx1;
-          evt.toX = ly;
-          evt.toY = 3 - lx2;
-          break;
-        }
-        events.push_back(evt);
-      }
+      for (int m = 0; m < row.moveCount; ++m)
+        policy.record(row.moves[m], y, dir);
     }
   }
 
@@ -110,124 +255,139 @@ GameLogic::MoveResult GameLogic::move(Grid &grid, Direction dir) {
     break;
   }
 
-  // Add Spawn Event if moved logic is handled by caller?
-  // Usually Game adds a tile if moved. Game should generate the Spawn Event
-  // manually after this.
-
-  return {changed, totalScore, events};
+  return {changed, totalScore,
+          std::vector<MoveEvent>(events.begin(), events.end())};
 }
 
-std::tuple<bool, int, std::vector<GameLogic::RowMove>>
-GameLogic::slideAndMergeRow(std::array<Tile, 4> &row) {
-  bool rowChanged = false;
-  int score = 0;
-  std::vector<RowMove> moves;
+GameLogic::RowResult GameLogic::slideAndMergeRow(std::array<Tile, 4> &row) {
+  RowResult result{false, 0, {}, 0};
 
   struct BufferedTile {
     int val;
     int originalIndex;
   };
-  std::vector<BufferedTile> buffer;
-  buffer.reserve(4);
+  std::array<BufferedTile, 4> buffer;
+  int bufferSize = 0;
 
   // Phase 1: Compression
   for (int i = 0; i < 4; ++i) {
     if (!row[i].isEmpty()) {
-      buffer.push_back({row[i].getValue(), i});
+      buffer[bufferSize++] = {row[i].getValue(), i};
     }
   }
 
-  std::vector<Tile> mergedResult;
-  mergedResult.reserve(4);
+  // Phase 2: Merge (merged result pre-filled with empty tiles)
+  std::array<Tile, 4> mergedResult;
   int writeIdx = 0;
 
-  for (size_t i = 0; i < buffer.size(); ++i) {
-    if (i < buffer.size() - 1 && buffer[i].val == buffer[i + 1].val) {
+  for (int i = 0; i < bufferSize; ++i) {
+    if (i < bufferSize - 1 && buffer[i].val == buffer[i + 1].val) {
       // MERGE
       int newVal = buffer[i].val * 2;
-      score += newVal;
+      result.score += newVal;
 
       Tile t(newVal);
       t.setMerged(true);
-      mergedResult.push_back(t);
+      mergedResult[writeIdx] = t;
 
       // Record Moves
-      moves.push_back({buffer[i].originalIndex, writeIdx, true, buffer[i].val});
-      moves.push_back(
-          {buffer[i + 1].originalIndex, writeIdx, true, buffer[i + 1].val});
+      result.moves[result.moveCount++] = {buffer[i].originalIndex, writeIdx,
+                                          true, buffer[i].val};
+      result.moves[result.moveCount++] = {buffer[i + 1].originalIndex,
+                                          writeIdx, true, buffer[i + 1].val};
 
       i++; // Skip next
       writeIdx++;
     } else {
       // KEEP
-      mergedResult.push_back(Tile(buffer[i].val));
+      mergedResult[writeIdx] = Tile(buffer[i].val);
 
-      // Record Move (only if moved)
+      // Record Move (only if moved; a single tile cannot merge in place)
       if (buffer[i].originalIndex != writeIdx) {
-        moves.push_back(
-            {buffer[i].originalIndex, writeIdx, false, buffer[i].val});
-      } else {
-        // Even if it didn't move index, we might want to record it for
-        // consistency if we animate everything? Optimisation: Only animate if
-        // moved. But what if it stays still but merges? (Not possible here,
-        // only single tile) So if index is same, no animation needed.
+        result.moves[result.moveCount++] = {buffer[i].originalIndex, writeIdx,
+                                            false, buffer[i].val};
       }
       writeIdx++;
     }
   }
 
-  // Phase 3: Fill Empty
-  while (mergedResult.size() < 4) {
-    mergedResult.push_back(Tile(0));
-  }
-
   // Write Back & Detect Change
   for (int i = 0; i < 4; ++i) {
     if (row[i].getValue() != mergedResult[i].getValue()) {
-      rowChanged = true;
+      result.changed = true;
     }
     row[i] = mergedResult[i];
   }
 
-  return {rowChanged, score, moves};
+  return result;
 }
 
-bool GameLogic::isGameOver(const Grid &grid) const {
-  // 1. Check for empty tiles
-  for (int y = 0; y < 4; ++y) {
-    for (int x = 0; x < 4; ++x) {
-      if (grid.getTile(x, y).isEmpty()) {
-        return false; // Empty slot exists -> Playable
-      }
-    }
-  }
+namespace {
 
-  // 2. Check for possible merges (Horizontal)
-  for (int y = 0; y < 4; ++y) {
-    for (int x = 0; x < 3; ++x) {
-      if (grid.getTile(x, y).getValue() == grid.getTile(x + 1, y).getValue()) {
-        return false; // Merge possible
-      }
-    }
-  }
+constexpr std::uint64_t LOW_BITS = 0x7F7F7F7F7F7F7F7FULL;
+constexpr std::uint64_t HIGH_BITS = 0x8080808080808080ULL;
+// Byte lanes of the cells in columns 0-2, and in rows 0-2 of the lower word
+constexpr std::uint64_t NOT_LAST_COLUMN = 0x0080808000808080ULL;
+constexpr std::uint64_t NOT_LAST_ROW = 0x0000000080808080ULL;
 
-  // 3. Check for possible merges (Vertical)
-  for (int x = 0; x < 4; ++x) {
-    for (int y = 0; y < 3; ++y) {
-      if (grid.getTile(x, y).getValue() == grid.getTile(x, y + 1).getValue()) {
-        return false; // Merge possible
-      }
-    }
+// 0x80 in every zero byte of v; exact, no carry crosses a lane
+constexpr std::uint64_t zeroBytes(std::uint64_t v) {
+  return ~(((v & LOW_BITS) + LOW_BITS) | v) & HIGH_BITS;
+}
+
+} // namespace
+
+std::uint8_t GameLogic::legalMoves(const Grid &grid) {
+  // Compare all eight cells of two rows at once; `below` holds the next row
+  // of every cell (zero past the bottom edge, masked off)
+  const auto [upper, lower] = grid.exponentWords();
+  const std::uint64_t words[2] = {upper, lower};
+  const std::uint64_t belows[2] = {(upper >> 32) | (lower << 32), lower >> 32};
+  const std::uint64_t rowMasks[2] = {HIGH_BITS, NOT_LAST_ROW};
+
+  std::uint64_t left = 0, right = 0, up = 0, down = 0;
+  for (int w = 0; w < 2; ++w) {
+    const std::uint64_t cells = words[w];
+    const std::uint64_t below = belows[w];
+    const std::uint64_t empty = zeroBytes(cells);
+    const std::uint64_t occupied = empty ^ HIGH_BITS;
+
+    // Two equal tiles touching along an axis can merge either way along it
+    const std::uint64_t sameH =
+        zeroBytes(cells ^ (cells >> 8)) & occupied & NOT_LAST_COLUMN;
+    const std::uint64_t sameV =
+        zeroBytes(cells ^ below) & occupied & rowMasks[w];
+
+    // Otherwise a tile needs an empty cell on the side it moves to
+    const std::uint64_t emptyBelow = zeroBytes(below);
+    left |= sameH | (empty & (occupied >> 8) & NOT_LAST_COLUMN);
+    right |= sameH | (occupied & (empty >> 8) & NOT_LAST_COLUMN);
+    up |= sameV | (empty & ~emptyBelow & rowMasks[w]);
+    down |= sameV | (occupied & emptyBelow & rowMasks[w]);
   }
 
-  return true; // Full and no merges
+  std::uint8_t mask = 0;
+  if (left)
+    mask |= directionBit(Direction::Left);
+  if (right)
+    mask |= directionBit(Direction::Right);
+  if (up)
+    mask |= directionBit(Direction::Up);
+  if (down)
+    mask |= directionBit(Direction::Down);
+  return mask;
+}
+
+bool GameLogic::isGameOver(const Grid &grid) const {
+  // Any empty slot keeps the game playable
+  return grid.emptyMask() == 0 && legalMoves(grid) == 0;
 }
 
 void GameLogic::reverseGrid(Grid &grid) {
   for (int y = 0; y < 4; ++y) {
     // We need to swap [x] with [3-x]
     for (int x = 0; x < 2; ++x) {
-      std::swap(grid.getTile(x, y), grid.getTile(3 - x, y));
+      grid.swapTiles(x, y, 3 - x, y);
     }
   }
 }
@@ -235,7 +395,7 @@ void GameLogic::reverseGrid(Grid &grid) {
 void GameLogic::transposeGrid(Grid &grid) {
   for (int y = 0; y < 4; ++y) {
     for (int x = y + 1; x < 4; ++x) {
-      std::swap(grid.getTile(x, y), grid.getTile(y, x));
+      grid.swapTiles(x, y, y, x);
     }
   }
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include "Grid.hpp"
+#include <array>
+#include <cstdint>
 #include <vector>
 
 namespace Core {
@@ -23,15 +25,94 @@ public:
     std::vector<MoveEvent> events; // Added events list
   };
 
+  /**
+   * @brief Inline, fixed-capacity storage for the events of one move.
+   *
+   * Every tile produces at most one event per move, so 16 slots always
+   * suffice and recording events never allocates.
+   */
+  class MoveEventBuffer {
+  public:
+    static constexpr int CAPACITY = Grid::SIZE * Grid::SIZE;
+
+    void clear() { m_count = 0; }
+    void push(const MoveEvent &evt) { m_events[m_count++] = evt; }
+
+    [[nodiscard]] int size() const { return m_count; }
+    [[nodiscard]] bool empty() const { return m_count == 0; }
+    [[nodiscard]] const MoveEvent &operator[](int i) const {
+      return m_events[i];
+    }
+    [[nodiscard]] const MoveEvent *begin() const { return m_events.data(); }
+    [[nodiscard]] const MoveEvent *end() const {
+      return m_events.data() + m_count;
+    }
+
+  private:
+    std::array<MoveEvent, CAPACITY> m_events;
+    int m_count = 0;
+  };
+
+  // Result of the allocation-free move (events go to a MoveEventBuffer)
+  struct MoveSummary {
+    bool moved;
+    int score;
+  };
+
   /**
    * @brief Executes a move on the grid.
    *
+   * Convenience overload that copies the events into a std::vector.
+   * Hot paths should use the MoveEventBuffer overload instead.
+   *
    * @param grid The game grid to modify.
    * @param dir The direction to slide tiles.
    * @return MoveResult containing success flag and points earned.
    */
   MoveResult move(Grid &grid, Direction dir);
 
+  /**
+   * @brief Executes a move on the grid without any heap allocation.
+   *
+   * @param grid The game grid to modify.
+   * @param dir The direction to slide tiles.
+   * @param events Cleared, then filled with the Slide/Merge events.
+   * @return MoveSummary containing success flag and points earned.
+   */
+  MoveSummary move(Grid &grid, Direction dir, MoveEventBuffer &events);
+
+  /**
+   * @brief Executes a move without generating any MoveEvents.
+   *
+   * Same grid, score and merge flags as move(); meant for simulations and AI
+   * lookahead that never animate.
+   */
+  MoveSummary moveFast(Grid &grid, Direction dir);
+
+  /**
+   * @brief Reference move: transpose/reverse the grid, slide every row left
+   * with slideAndMergeRow, transform back.
+   *
+   * Slow but simple; kept to diff the direction kernels against (grid, merge
+   * flags, score and events must all match).
+   */
+  MoveResult moveReference(Grid &grid, Direction dir);
+
+  // Bit of dir in a legalMoves() mask
+  static constexpr std::uint8_t directionBit(Direction dir) {
+    return static_cast<std::uint8_t>(1u << static_cast<int>(dir));
+  }
+
+  /**
+   * @brief Directions that would change the grid.
+   *
+   * Computed bitwise from the cells (empty neighbours and equal pairs); the
+   * grid is neither copied nor modified.
+   *
+   * @return Mask of directionBit() values, 0 if no move is possible.
+   */
+  [[nodiscard]] static std::uint8_t legalMoves(const Grid &grid);
+
   // Checks if the game is over (no empty slots and no adjacent merges)
   bool isGameOver(const Grid &grid) const;
 
@@ -44,12 +125,37 @@ private:
     int value;
   };
 
+  // Compile-time event policies for moveImpl (defined in GameLogic.cpp)
+  struct RecordEvents; // Fills a MoveEventBuffer
+  struct SkipEvents;   // No event bookkeeping at all
+
+  // Runtime direction -> moveKernel<Dir>
+  template <typename EventPolicy>
+  MoveSummary moveImpl(Grid &grid, Direction dir, EventPolicy &policy);
+
+  // One move in Dir, walking rows/columns in place with strided indices
+  template <Direction Dir, typename EventPolicy>
+  MoveSummary moveKernel(Grid &grid, EventPolicy &policy);
+
+  // Packs lane `lane` (ordered towards the Dir edge) into 4-bit exponents
+  // for the MoveTables lookup. Returns false if the lane holds a tile too
+  // large for the tables.
+  template <Direction Dir>
+  static bool packLane(const Grid &grid, int lane, std::uint16_t &packed);
+
+  // Result of slideAndMergeRow: at most one RowMove per tile
+  struct RowResult {
+    bool changed;
+    int score;
+    std::array<RowMove, 4> moves;
+    int moveCount;
+  };
+
   // Helper to process a single row (Slide Left logic)
-  // Returns tuple: { changed, score_gained, row_moves }
-  std::tuple<bool, int, std::vector<RowMove>>
-  slideAndMergeRow(std::array<Tile, 4> &row);
+  // Reference path, used for rows the tables cannot represent
+  RowResult slideAndMergeRow(std::array<Tile, 4> &row);
 
-  // Helpers for Transformation Strategy
+  // Helpers for Transformation Strategy (moveReference only)
   void reverseGrid(Grid &grid);
   void transposeGrid(Grid &grid);
 };
@@ -1,62 +1,60 @@
 #include "Grid.hpp"
-#include <random>
-#include <vector>
+#include <type_traits>
 
 namespace Core {
 
-Grid::Grid() {
-  // Initialize RNG with a random device seed
-  std::random_device rd;
-  rng.seed(rd());
+static_assert(std::is_trivially_copyable_v<Grid>,
+              "Grid must stay a plain value (copied per move in search)");
+static_assert(sizeof(Grid) == 18, "16 exponents + 16-bit merged mask");
 
-  reset();
-}
+Grid::Grid() { reset(); }
 
 void Grid::reset() {
-  for (auto &row : tiles) {
-    for (auto &tile : row) {
-      tile = Tile(0); // Replace with empty tile
-    }
-  }
+  m_exponents.fill(0);
+  m_mergedMask = 0;
 }
 
-const Tile &Grid::getTile(int x, int y) const {
-  // In a real production engine, we might add bounds checking (asserts)
-  return tiles[y][x]; // Row-major: tiles[row][col] -> tiles[y][x]
-}
+void Grid::swapTiles(int x1, int y1, int x2, int y2) {
+  const int a = indexOf(x1, y1);
+  const int b = indexOf(x2, y2);
+  std::swap(m_exponents[a], m_exponents[b]);
 
-Tile &Grid::getTile(int x, int y) { return tiles[y][x]; }
+  const bool mergedA = (m_mergedMask >> a) & 1;
+  setMergedBit(a, (m_mergedMask >> b) & 1);
+  setMergedBit(b, mergedA);
+}
 
-std::pair<int, int> Grid::spawnRandomTile() {
-  std::vector<std::pair<int, int>> emptySlots;
-  for (int y = 0; y < SIZE;
-       ++y) { // Assuming SIZE is defined and used for grid dimensions
-    for (int x = 0; x < SIZE;
-         ++x) { // Assuming SIZE is defined and used for grid dimensions
-      if (tiles[y][x].isEmpty()) {
-        emptySlots.emplace_back(x, y);
-      }
+std::uint16_t Grid::emptyMask() const {
+  std::uint16_t mask = 0;
+  for (int i = 0; i < CELLS; ++i) {
+    if (m_exponents[i] == 0) {
+      mask |= static_cast<std::uint16_t>(1u << i);
     }
   }
+  return mask;
+}
 
-  if (emptySlots.empty()) {
+std::pair<int, int> Grid::spawnRandomTile(Rng &rng,
+                                          const SpawnDistribution &spawns) {
+  std::uint16_t empty = emptyMask();
+  if (empty == 0) {
     return {-1, -1};
   }
 
-  // Random selection
-  // Using the class's rng for consistency with other methods
-  std::uniform_int_distribution<int> slotDist(
-      0, static_cast<int>(emptySlots.size()) - 1);
-  int index = slotDist(rng);
-  auto [x, y] = emptySlots[index];
+  // Random selection: drop the k lowest empty slots, take the next one
+  auto k = rng.nextBelow(static_cast<std::uint32_t>(std::popcount(empty)));
+  for (; k > 0; --k) {
+    empty &= static_cast<std::uint16_t>(empty - 1);
+  }
+  const int slot = std::countr_zero(empty);
 
-  // 10% chance for 4, 90% for 2
-  // Using the class's rng for consistency with other methods
-  std::uniform_int_distribution<int> valueProb(0, 9);
-  int value = (valueProb(rng) < 1) ? 4 : 2;
+  m_exponents[slot] = static_cast<std::uint8_t>(spawns.sampleExponent(rng));
+  setMergedBit(slot, false);
+  return {slot % SIZE, slot / SIZE};
+}
 
-  tiles[y][x] = Tile(value);
-  return {x, y};
+std::pair<int, int> Grid::spawnRandomTile() {
+  return spawnRandomTile(Rng::threadDefault());
 }
 
 } // namespace Core
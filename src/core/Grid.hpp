@@ -1,15 +1,72 @@
 #pragma once
+#include "Rng.hpp"
+#include "SpawnDistribution.hpp"
 #include "Tile.hpp"
 #include <array>
-#include <random>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
 
 #include <utility> // For std::pair
 
 namespace Core {
 
+/**
+ * @brief The 4x4 game board.
+ *
+ * Stored structure-of-arrays: one log2 exponent per cell (0 = empty) plus a
+ * bitmask of the cells that merged during the last move, 18 bytes in total.
+ * A plain value type: trivially copyable and free of RNG state. Randomness
+ * comes from the Rng passed to spawnRandomTile().
+ *
+ * Tile values must be 0 or a power of two from 2 up; storing any other value
+ * through a TileRef throws std::invalid_argument.
+ */
 class Grid {
 public:
   static constexpr int SIZE = 4;
+  static constexpr int CELLS = SIZE * SIZE;
+
+  /**
+   * @brief Mutable view of one cell, returned by the non-const getTile().
+   *
+   * Keeps the Tile API (getValue/setValue/setMerged, assignment from a Tile)
+   * while the data lives in the Grid's packed arrays.
+   */
+  class TileRef {
+  public:
+    TileRef(Grid &grid, int index) : m_grid(&grid), m_index(index) {}
+
+    // Assigns value and merge flag of another tile (not the reference)
+    TileRef &operator=(const Tile &tile) {
+      setValue(tile.getValue());
+      setMerged(tile.hasMerged());
+      return *this;
+    }
+    TileRef &operator=(const TileRef &other) {
+      return *this = static_cast<Tile>(other);
+    }
+    operator Tile() const { return m_grid->tileAt(m_index); }
+
+    [[nodiscard]] int getValue() const {
+      return valueOf(m_grid->m_exponents[m_index]);
+    }
+    [[nodiscard]] bool isEmpty() const {
+      return m_grid->m_exponents[m_index] == 0;
+    }
+    [[nodiscard]] bool hasMerged() const {
+      return (m_grid->m_mergedMask >> m_index) & 1;
+    }
+
+    void setValue(int val) { m_grid->m_exponents[m_index] = exponentOf(val); }
+    void setMerged(bool merged) { m_grid->setMergedBit(m_index, merged); }
+    void resetMerged() { setMerged(false); }
+
+  private:
+    Grid *m_grid;
+    int m_index;
+  };
 
   Grid();
 
@@ -17,25 +74,85 @@ public:
   void reset();
 
   /**
-   * @brief Spawns a new tile (2 or 4) in a random empty slot.
+   * @brief Spawns a new tile in a random empty slot.
+   * Allocation-free: the slot is picked from emptyMask().
+   * @param rng Random source (explicitly seeded by the caller).
+   * @param spawns Tiles and odds (default: 2 at 90%, 4 at 10%).
    * @return {x, y} of the spawned tile, or {-1, -1} if full.
    */
+  std::pair<int, int>
+  spawnRandomTile(Rng &rng,
+                  const SpawnDistribution &spawns = SpawnDistribution::classic());
+
+  // Same with classic odds, drawing from Rng::threadDefault()
   std::pair<int, int> spawnRandomTile();
 
+  // Bit (y * SIZE + x) is set when that cell is empty
+  [[nodiscard]] std::uint16_t emptyMask() const;
+
   /**
    * @brief Access a tile at specific coordinates.
    * @param x Column (0-3)
    * @param y Row (0-3)
-   * @return const reference and non-const reference overloads
+   * @return Tile copy (const) or a TileRef view (non-const)
    */
-  [[nodiscard]] const Tile &getTile(int x, int y) const;
-  [[nodiscard]] Tile &getTile(int x, int y);
+  [[nodiscard]] Tile getTile(int x, int y) const {
+    return tileAt(indexOf(x, y));
+  }
+  [[nodiscard]] TileRef getTile(int x, int y) {
+    return TileRef(*this, indexOf(x, y));
+  }
+
+  // Packed access for the move engine (exponent 0 = empty)
+  [[nodiscard]] int getExponent(int x, int y) const {
+    return m_exponents[indexOf(x, y)];
+  }
+  void setExponent(int x, int y, int exponent) {
+    m_exponents[indexOf(x, y)] = static_cast<std::uint8_t>(exponent);
+  }
+  void swapTiles(int x1, int y1, int x2, int y2);
+
+  // Exponents eight to a word, cell i in byte i % 8: rows 0-1, then rows 2-3
+  [[nodiscard]] std::array<std::uint64_t, 2> exponentWords() const {
+    std::array<std::uint64_t, 2> words{};
+    for (int i = 0; i < CELLS; ++i)
+      words[i / 8] |= std::uint64_t{m_exponents[i]} << (8 * (i % 8));
+    return words;
+  }
+
+  // Bit (y * SIZE + x) is set when that cell merged during the last move
+  [[nodiscard]] std::uint16_t mergedMask() const { return m_mergedMask; }
+  void clearMergedFlags() { m_mergedMask = 0; }
 
 private:
-  std::array<std::array<Tile, SIZE>, SIZE> tiles;
+  static constexpr int indexOf(int x, int y) { return y * SIZE + x; }
+  static constexpr int valueOf(std::uint8_t exponent) {
+    return exponent == 0 ? 0 : 1 << exponent;
+  }
+  static std::uint8_t exponentOf(int value) {
+    if (value == 0)
+      return 0;
+    if (value < 2 || !std::has_single_bit(static_cast<unsigned>(value))) {
+      throw std::invalid_argument("Tile value must be 0 or a power of two: " +
+                                  std::to_string(value));
+    }
+    return static_cast<std::uint8_t>(
+        std::countr_zero(static_cast<unsigned>(value)));
+  }
+
+  [[nodiscard]] Tile tileAt(int index) const {
+    Tile tile(valueOf(m_exponents[index]));
+    tile.setMerged((m_mergedMask >> index) & 1);
+    return tile;
+  }
+  void setMergedBit(int index, bool merged) {
+    const auto bit = static_cast<std::uint16_t>(1u << index);
+    m_mergedMask = merged ? (m_mergedMask | bit)
+                          : static_cast<std::uint16_t>(m_mergedMask & ~bit);
+  }
 
-  // Random number generation components
-  std::mt19937 rng;
+  std::array<std::uint8_t, CELLS> m_exponents; // Row-major, y * SIZE + x
+  std::uint16_t m_mergedMask;
 };
 
 } // namespace Core
@@ -0,0 +1,74 @@
+#include "MoveTables.hpp"
+
+namespace Core {
+
+namespace {
+
+constexpr int MAX_EXPONENT = 15;
+
+// Reference slide of one packed row towards cell 0 (same rules as
+// GameLogic::slideAndMergeRow).
+RowMoveEntry computeLeft(std::uint16_t row) {
+  RowMoveEntry entry{0, 0, 0, 0};
+
+  int lastExp = 0;     // Exponent of the last written, still mergeable cell
+  int writeIdx = 0;    // Next free destination
+  int lastSource = -1; // Source cell that produced the last written cell
+
+  for (int i = 0; i < 4; ++i) {
+    const int e = (row >> (4 * i)) & 0xF;
+    if (e == 0)
+      continue;
+
+    if (lastSource >= 0 && e == lastExp && e < MAX_EXPONENT) {
+      // Merge into the previously written cell
+      const int dest = writeIdx - 1;
+      entry.row = static_cast<std::uint16_t>(
+          (entry.row & ~(0xF << (4 * dest))) | ((e + 1) << (4 * dest)));
+      entry.score += 1u << (e + 1);
+      entry.targets |= static_cast<std::uint8_t>(dest << (2 * i));
+      entry.merges |= static_cast<std::uint8_t>((1 << i) | (1 << lastSource));
+      lastSource = -1; // A merged tile cannot merge again this move
+      continue;
+    }
+
+    entry.row |= static_cast<std::uint16_t>(e << (4 * writeIdx));
+    entry.targets |= static_cast<std::uint8_t>(writeIdx << (2 * i));
+    lastExp = e;
+    lastSource = i;
+    ++writeIdx;
+  }
+  return entry;
+}
+
+// Right move of a row = mirrored Left move of the mirrored row.
+RowMoveEntry mirror(const RowMoveEntry &leftOfReversed) {
+  RowMoveEntry entry{MoveTables::reverseRow(leftOfReversed.row), 0, 0,
+                     leftOfReversed.score};
+  for (int i = 0; i < 4; ++i) {
+    const int src = 3 - i; // Source cell i is cell (3 - i) in the mirror
+    entry.targets |=
+        static_cast<std::uint8_t>((3 - leftOfReversed.targetOf(src)) << (2 * i));
+    if (leftOfReversed.mergedFrom(src))
+      entry.merges |= static_cast<std::uint8_t>(1 << i);
+  }
+  return entry;
+}
+
+} // namespace
+
+const MoveTables &MoveTables::instance() {
+  static const MoveTables tables;
+  return tables;
+}
+
+MoveTables::MoveTables() {
+  for (int row = 0; row < ROW_COUNT; ++row) {
+    m_left[row] = computeLeft(static_cast<std::uint16_t>(row));
+  }
+  for (int row = 0; row < ROW_COUNT; ++row) {
+    m_right[row] = mirror(m_left[reverseRow(static_cast<std::uint16_t>(row))]);
+  }
+}
+
+} // namespace Core
@@ -0,0 +1,70 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace Core {
+
+/**
+ * @brief Precomputed result of sliding one packed row.
+ *
+ * A packed row holds four 4-bit exponents, cell 0 in the lowest nibble
+ * (same layout as a Bitboard row).
+ */
+struct RowMoveEntry {
+  std::uint16_t row;     // Resulting packed row
+  std::uint8_t targets;  // 2 bits per occupied source cell: destination
+  std::uint8_t merges;   // Bit i set if source cell i took part in a merge
+  std::uint32_t score;   // Points gained by merges in this row
+
+  [[nodiscard]] constexpr int targetOf(int cell) const {
+    return (targets >> (2 * cell)) & 0x3;
+  }
+  [[nodiscard]] constexpr bool mergedFrom(int cell) const {
+    return (merges >> cell) & 0x1;
+  }
+};
+
+/**
+ * @brief Lookup tables for all 65,536 packed rows, built once on first use.
+ *
+ * "Left" slides towards cell 0, "Right" towards cell 3. Columns use the same
+ * tables once read into a packed row (Up = Left, Down = Right).
+ * Two 15-exponent tiles (32768) never merge: 65536 does not fit in a nibble.
+ */
+class MoveTables {
+public:
+  static constexpr int ROW_COUNT = 1 << 16;
+
+  // Thread-safe lazy singleton (~1 MB)
+  [[nodiscard]] static const MoveTables &instance();
+
+  [[nodiscard]] const RowMoveEntry &left(std::uint16_t row) const {
+    return m_left[row];
+  }
+  [[nodiscard]] const RowMoveEntry &right(std::uint16_t row) const {
+    return m_right[row];
+  }
+
+  // Contiguous tables indexed by packed row (for SIMD gathers)
+  [[nodiscard]] const RowMoveEntry *leftData() const { return m_left.data(); }
+  [[nodiscard]] const RowMoveEntry *rightData() const {
+    return m_right.data();
+  }
+
+  // Mirrors a packed row: [a b c d] -> [d c b a]
+  [[nodiscard]] static constexpr std::uint16_t reverseRow(std::uint16_t row) {
+    return static_cast<std::uint16_t>((row >> 12) | ((row >> 4) & 0x00F0) |
+                                      ((row << 4) & 0x0F00) | (row << 12));
+  }
+
+  MoveTables(const MoveTables &) = delete;
+  MoveTables &operator=(const MoveTables &) = delete;
+
+private:
+  MoveTables();
+
+  std::array<RowMoveEntry, ROW_COUNT> m_left;
+  std::array<RowMoveEntry, ROW_COUNT> m_right;
+};
+
+} // namespace Core
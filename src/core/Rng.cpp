@@ -0,0 +1,18 @@
+#include "Rng.hpp"
+#include <random>
+
+namespace Core {
+
+Rng Rng::fromEntropy() {
+  std::random_device rd;
+  const std::uint64_t seed =
+      (static_cast<std::uint64_t>(rd()) << 32) ^ static_cast<std::uint64_t>(rd());
+  return Rng(seed);
+}
+
+Rng &Rng::threadDefault() {
+  thread_local Rng rng = fromEntropy();
+  return rng;
+}
+
+} // namespace Core
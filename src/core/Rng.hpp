@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace Core {
+
+/**
+ * @brief Small, explicitly seeded random source (xoshiro256**).
+ *
+ * 32 bytes of state, trivially copyable, no system calls once seeded.
+ * Satisfies UniformRandomBitGenerator, so it also works with <random>
+ * distributions.
+ */
+class Rng {
+public:
+  using result_type = std::uint64_t;
+
+  explicit Rng(std::uint64_t seed = 0) { reseed(seed); }
+
+  // Seeded from std::random_device (one-off cost, e.g. at game start)
+  [[nodiscard]] static Rng fromEntropy();
+
+  // Per-thread source used by the convenience overloads that take no Rng
+  [[nodiscard]] static Rng &threadDefault();
+
+  void reseed(std::uint64_t seed) {
+    // Expand the seed with SplitMix64 so that nearby seeds diverge
+    for (auto &word : s) {
+      seed += 0x9E3779B97F4A7C15ULL;
+      std::uint64_t z = seed;
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      word = z ^ (z >> 31);
+    }
+  }
+
+  std::uint64_t next() {
+    const std::uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const std::uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+    return result;
+  }
+
+  /**
+   * @brief Advances the state by 2^128 steps.
+   *
+   * Calling jump() k times on copies of one generator yields k
+   * non-overlapping streams (e.g. one per worker thread).
+   */
+  void jump() {
+    constexpr std::uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                      0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    std::uint64_t t[4] = {0, 0, 0, 0};
+    for (std::uint64_t word : JUMP) {
+      for (int b = 0; b < 64; ++b) {
+        if (word & (std::uint64_t{1} << b)) {
+          for (int i = 0; i < 4; ++i)
+            t[i] ^= s[i];
+        }
+        next();
+      }
+    }
+    for (int i = 0; i < 4; ++i)
+      s[i] = t[i];
+  }
+
+  /**
+   * @brief Uniform integer in [0, bound) without modulo bias.
+   * @param bound Must be > 0.
+   */
+  std::uint32_t nextBelow(std::uint32_t bound) {
+    // Lemire's multiply-shift with rejection
+    std::uint64_t m = (next() >> 32) * bound;
+    auto low = static_cast<std::uint32_t>(m);
+    if (low < bound) {
+      const std::uint32_t threshold = (0u - bound) % bound;
+      while (low < threshold) {
+        m = (next() >> 32) * bound;
+        low = static_cast<std::uint32_t>(m);
+      }
+    }
+    return static_cast<std::uint32_t>(m >> 32);
+  }
+
+  // UniformRandomBitGenerator interface
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+  result_type operator()() { return next(); }
+
+private:
+  static constexpr std::uint64_t rotl(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::uint64_t s[4];
+};
+
+} // namespace Core
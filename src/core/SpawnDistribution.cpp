@@ -0,0 +1,28 @@
+#include "SpawnDistribution.hpp"
+#include <stdexcept>
+
+namespace Core {
+
+const SpawnDistribution &SpawnDistribution::classic() {
+  static const SpawnDistribution distribution{{2, 1}, {1, 9}};
+  return distribution;
+}
+
+SpawnDistribution::SpawnDistribution(std::initializer_list<Outcome> outcomes) {
+  if (outcomes.size() == 0 || outcomes.size() > MAX_OUTCOMES)
+    throw std::invalid_argument("SpawnDistribution needs 1 to 4 outcomes");
+
+  for (const Outcome &outcome : outcomes) {
+    if (outcome.exponent < 1 || outcome.exponent > 15)
+      throw std::invalid_argument("Spawned tile must be between 2 and 32768");
+    if (outcome.weight == 0)
+      throw std::invalid_argument("Spawn outcome weight must be positive");
+    m_outcomes[m_size++] = outcome;
+    m_total += outcome.weight;
+  }
+  for (int i = 0; i < m_size; ++i)
+    m_probabilities[i] =
+        static_cast<double>(m_outcomes[i].weight) / static_cast<double>(m_total);
+}
+
+} // namespace Core
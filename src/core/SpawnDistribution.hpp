@@ -0,0 +1,71 @@
+#pragma once
+#include "Rng.hpp"
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Core {
+
+/**
+ * @brief Which tile a spawn creates and how likely each one is.
+ *
+ * Up to MAX_OUTCOMES tiles with integer weights, so that sampling is an
+ * exact Rng::nextBelow(totalWeight()) draw. Grid::spawnRandomTile,
+ * Bitboard::spawnRandom and Bitboard::forEachSpawn all take one, so the
+ * game and the searches that predict it use the same odds.
+ *
+ * Trivially copyable; no heap use.
+ */
+class SpawnDistribution {
+public:
+  static constexpr int MAX_OUTCOMES = 4;
+
+  struct Outcome {
+    int exponent;         // log2 of the spawned tile, 1-15
+    std::uint32_t weight; // Relative frequency, > 0
+  };
+
+  /**
+   * @brief The original game: a 2 with 90%, a 4 with 10%.
+   *
+   * The 4 is listed first so that seeds replay the same games as the
+   * hard-coded split that preceded this class (draw 0 of 10 gave a 4).
+   */
+  [[nodiscard]] static const SpawnDistribution &classic();
+
+  /**
+   * @param outcomes 1 to MAX_OUTCOMES tiles, sampled in list order.
+   * @throws std::invalid_argument for an empty or oversized list, an
+   *         exponent outside [1, 15] or a zero weight.
+   */
+  SpawnDistribution(std::initializer_list<Outcome> outcomes);
+
+  [[nodiscard]] int size() const { return m_size; }
+  [[nodiscard]] const Outcome &outcome(int i) const { return m_outcomes[i]; }
+  [[nodiscard]] double probability(int i) const { return m_probabilities[i]; }
+  [[nodiscard]] std::uint32_t totalWeight() const { return m_total; }
+
+  // Index of a random outcome (one Rng draw)
+  [[nodiscard]] int sampleIndex(Rng &rng) const {
+    std::uint32_t r = rng.nextBelow(m_total);
+    int i = 0;
+    while (r >= m_outcomes[i].weight) {
+      r -= m_outcomes[i].weight;
+      ++i;
+    }
+    return i;
+  }
+
+  // Exponent of a random outcome (one Rng draw)
+  [[nodiscard]] int sampleExponent(Rng &rng) const {
+    return m_outcomes[sampleIndex(rng)].exponent;
+  }
+
+private:
+  std::array<Outcome, MAX_OUTCOMES> m_outcomes{};
+  std::array<double, MAX_OUTCOMES> m_probabilities{};
+  std::uint32_t m_total = 0;
+  int m_size = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,63 @@
+#include "Symmetry.hpp"
+
+namespace Core {
+
+namespace {
+
+constexpr std::uint8_t TRANSPOSE = 4;
+constexpr std::uint8_t FLIP = 2;
+constexpr std::uint8_t MIRROR = 1;
+
+// Per-step direction maps, indexed by Direction (Up, Down, Left, Right)
+constexpr Direction TRANSPOSED_DIR[] = {Direction::Left, Direction::Right,
+                                        Direction::Up, Direction::Down};
+constexpr Direction FLIPPED_DIR[] = {Direction::Down, Direction::Up,
+                                     Direction::Left, Direction::Right};
+constexpr Direction MIRRORED_DIR[] = {Direction::Up, Direction::Down,
+                                      Direction::Right, Direction::Left};
+
+} // namespace
+
+Bitboard transform(Bitboard board, Symmetry symmetry) {
+  const auto bits = static_cast<std::uint8_t>(symmetry);
+  if (bits & TRANSPOSE)
+    board = board.transposed();
+  if (bits & FLIP)
+    board = board.flipped();
+  if (bits & MIRROR)
+    board = board.mirrored();
+  return board;
+}
+
+Direction transform(Direction dir, Symmetry symmetry) {
+  const auto bits = static_cast<std::uint8_t>(symmetry);
+  if (bits & TRANSPOSE)
+    dir = TRANSPOSED_DIR[static_cast<int>(dir)];
+  if (bits & FLIP)
+    dir = FLIPPED_DIR[static_cast<int>(dir)];
+  if (bits & MIRROR)
+    dir = MIRRORED_DIR[static_cast<int>(dir)];
+  return dir;
+}
+
+Symmetry inverse(Symmetry symmetry) {
+  // Flip and mirror are involutions that commute. Undoing a transpose
+  // swaps them, since flip-then-transpose equals transpose-then-mirror.
+  const auto bits = static_cast<std::uint8_t>(symmetry);
+  if (!(bits & TRANSPOSE))
+    return symmetry;
+  return static_cast<Symmetry>(TRANSPOSE | ((bits & FLIP) ? MIRROR : 0) |
+                               ((bits & MIRROR) ? FLIP : 0));
+}
+
+CanonicalBoard canonicalize(Bitboard board) {
+  const auto images = symmetricImages(board);
+  CanonicalBoard best{images[0], Symmetry::Identity};
+  for (int s = 1; s < SYMMETRY_COUNT; ++s) {
+    if (images[s].raw() < best.board.raw())
+      best = {images[s], static_cast<Symmetry>(s)};
+  }
+  return best;
+}
+
+} // namespace Core
@@ -0,0 +1,68 @@
+#pragma once
+#include "Bitboard.hpp"
+#include <array>
+#include <cstdint>
+
+namespace Core {
+
+/**
+ * @brief One of the 8 rotations/reflections of the board (dihedral group).
+ *
+ * The value is a bit set applied in a fixed order: bit 2 transposes, then
+ * bit 1 reverses the rows (flip), then bit 0 reverses every row (mirror).
+ * Rotations are named as seen on screen, with row 0 at the top.
+ */
+enum class Symmetry : std::uint8_t {
+  Identity,
+  Mirror,                 // x -> 3 - x
+  Flip,                   // y -> 3 - y
+  Rotate180,
+  Transpose,              // (x, y) -> (y, x)
+  RotateClockwise,
+  RotateCounterClockwise,
+  AntiTranspose,          // (x, y) -> (3 - y, 3 - x)
+};
+
+inline constexpr int SYMMETRY_COUNT = 8;
+
+// A board's smallest symmetric image and the symmetry that produced it
+struct CanonicalBoard {
+  Bitboard board;
+  Symmetry symmetry; // transform(original, symmetry) == board
+};
+
+// Image of a board under a symmetry.
+[[nodiscard]] Bitboard transform(Bitboard board, Symmetry symmetry);
+
+/**
+ * @brief Direction that does on the transformed board what `dir` does on
+ * the original: transform(b.move(dir).board, s) ==
+ * transform(b, s).move(transform(dir, s)).board.
+ */
+[[nodiscard]] Direction transform(Direction dir, Symmetry symmetry);
+
+// Symmetry that undoes `symmetry`.
+[[nodiscard]] Symmetry inverse(Symmetry symmetry);
+
+/**
+ * @brief The 8 images of a board, indexed by Symmetry (identity first).
+ * Computes one transpose and three cheap nibble shuffles.
+ */
+[[nodiscard]] inline std::array<Bitboard, SYMMETRY_COUNT>
+symmetricImages(Bitboard board) {
+  const Bitboard t = board.transposed();
+  return {board,     board.mirrored(),     board.flipped(),
+          board.flipped().mirrored(),      t,
+          t.mirrored(), t.flipped(),       t.flipped().mirrored()};
+}
+
+/**
+ * @brief Smallest raw() among the 8 images, so every symmetric position
+ * maps to the same key. Ties (symmetric boards) take the lowest Symmetry.
+ *
+ * A move chosen on the canonical board is played on the original as
+ * transform(move, inverse(result.symmetry)).
+ */
+[[nodiscard]] CanonicalBoard canonicalize(Bitboard board);
+
+} // namespace Core
@@ -1,4 +1,5 @@
 #include "Font.hpp"
+#include <iostream>
 #include <stdexcept>
 
 namespace Engine {
@@ -12,21 +13,45 @@ Font::Font(const std::string &filePath, int ptSize) : font(nullptr) {
 }
 
 Font::~Font() {
+  atlas.reset(); // Uses the font for kerning
   if (font) {
     TTF_CloseFont(font);
   }
 }
 
-Font::Font(Font &&other) noexcept : font(other.font) { other.font = nullptr; }
+Font::Font(Font &&other) noexcept
+    : font(other.font), atlas(std::move(other.atlas)),
+      atlasFailed(other.atlasFailed) {
+  other.font = nullptr;
+}
 
 Font &Font::operator=(Font &&other) noexcept {
   if (this != &other) {
+    atlas.reset();
     if (font)
       TTF_CloseFont(font);
     font = other.font;
+    atlas = std::move(other.atlas);
+    atlasFailed = other.atlasFailed;
     other.font = nullptr;
   }
   return *this;
 }
 
+const GlyphAtlas *Font::getAtlas(SDL_Renderer *renderer) const {
+  if (atlas && atlas->getRenderer() == renderer)
+    return atlas.get();
+  if (atlasFailed || !font)
+    return nullptr;
+  try {
+    atlas = std::make_unique<GlyphAtlas>(renderer, font);
+  } catch (const std::exception &e) {
+    std::cerr << "Glyph atlas unavailable, using TTF text: " << e.what()
+              << std::endl;
+    atlasFailed = true;
+    return nullptr;
+  }
+  return atlas.get();
+}
+
 } // namespace Engine
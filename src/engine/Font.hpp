@@ -1,5 +1,7 @@
 #pragma once
+#include "GlyphAtlas.hpp"
 #include <SDL_ttf.h>
+#include <memory>
 #include <string>
 
 namespace Engine {
@@ -19,8 +21,16 @@ public:
 
   [[nodiscard]] TTF_Font *getNativeHandle() const { return font; }
 
+  /**
+   * @brief Glyph page of this font for `renderer`, rasterized on first use.
+   * Returns nullptr if it cannot be built (callers then render via TTF).
+   */
+  [[nodiscard]] const GlyphAtlas *getAtlas(SDL_Renderer *renderer) const;
+
 private:
   TTF_Font *font;
+  mutable std::unique_ptr<GlyphAtlas> atlas;
+  mutable bool atlasFailed = false; // Do not retry every frame
 };
 
 } // namespace Engine
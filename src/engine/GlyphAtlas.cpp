@@ -0,0 +1,165 @@
+#include "GlyphAtlas.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace Engine {
+
+namespace {
+
+// Empty texels between glyphs so that filtering never bleeds a neighbour in
+constexpr int PADDING = 1;
+
+} // namespace
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font)
+    : m_renderer(renderer), m_font(font), m_texture(nullptr), m_width(0),
+      m_height(0), m_lineHeight(TTF_FontHeight(font)), m_glyphs{} {
+  // 1. Rasterize every glyph once, in white (vertex colors tint them)
+  std::array<SDL_Surface *, LAST_CHAR - FIRST_CHAR + 1> surfaces{};
+  auto freeSurfaces = [&surfaces]() {
+    for (SDL_Surface *surface : surfaces)
+      if (surface)
+        SDL_FreeSurface(surface);
+  };
+
+  const SDL_Color white = {255, 255, 255, 255};
+  int widest = 0;
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    const auto ch = static_cast<Uint16>(FIRST_CHAR + i);
+    int minX, maxX, minY, maxY, advance;
+    if (TTF_GlyphMetrics(font, ch, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+      freeSurfaces();
+      throw std::runtime_error("TTF_GlyphMetrics failed: " +
+                               std::string(TTF_GetError()));
+    }
+    m_glyphs[i].advance = advance;
+    if (ch == ' ')
+      continue; // Nothing to draw
+
+    surfaces[i] = TTF_RenderGlyph_Blended(font, ch, white);
+    if (!surfaces[i]) {
+      freeSurfaces();
+      throw std::runtime_error("TTF_RenderGlyph_Blended failed: " +
+                               std::string(TTF_GetError()));
+    }
+    widest = std::max(widest, surfaces[i]->w);
+  }
+
+  // 2. Shelf packing; the page width doubles until the page is no taller
+  // than it is wide
+  auto pack = [&](int pageWidth) {
+    int x = PADDING;
+    int y = PADDING;
+    int rowHeight = 0;
+    for (std::size_t i = 0; i < surfaces.size(); ++i) {
+      if (!surfaces[i])
+        continue;
+      const int w = surfaces[i]->w;
+      const int h = surfaces[i]->h;
+      if (x + w + PADDING > pageWidth) {
+        x = PADDING;
+        y += rowHeight + PADDING;
+        rowHeight = 0;
+      }
+      m_glyphs[i].src = {x, y, w, h};
+      x += w + PADDING;
+      rowHeight = std::max(rowHeight, h);
+    }
+    return y + rowHeight + PADDING;
+  };
+  int pageWidth = 64;
+  while (pageWidth < widest + 2 * PADDING)
+    pageWidth *= 2;
+  while (pack(pageWidth) > pageWidth)
+    pageWidth *= 2;
+  m_width = pageWidth;
+  m_height = pack(pageWidth);
+
+  // 3. Copy the glyphs (alpha included) into one page and upload it
+  SDL_Surface *page = SDL_CreateRGBSurfaceWithFormat(0, m_width, m_height, 32,
+                                                     SDL_PIXELFORMAT_RGBA32);
+  if (!page) {
+    freeSurfaces();
+    throw std::runtime_error("Glyph page creation failed: " +
+                             std::string(SDL_GetError()));
+  }
+  for (std::size_t i = 0; i < surfaces.size(); ++i) {
+    if (!surfaces[i])
+      continue;
+    SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+    SDL_Rect dst = m_glyphs[i].src;
+    SDL_BlitSurface(surfaces[i], nullptr, page, &dst);
+  }
+  freeSurfaces();
+
+  m_texture = SDL_CreateTextureFromSurface(renderer, page);
+  SDL_FreeSurface(page);
+  if (!m_texture) {
+    throw std::runtime_error("Glyph texture creation failed: " +
+                             std::string(SDL_GetError()));
+  }
+  SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+}
+
+GlyphAtlas::~GlyphAtlas() {
+  if (m_texture) {
+    SDL_DestroyTexture(m_texture);
+  }
+}
+
+bool GlyphAtlas::covers(const std::string &text) const {
+  return std::all_of(text.begin(), text.end(), [](char c) {
+    return c >= FIRST_CHAR && c <= LAST_CHAR;
+  });
+}
+
+int GlyphAtlas::kerning(char previous, char c) const {
+  return TTF_GetFontKerningSizeGlyphs(m_font, static_cast<Uint16>(previous),
+                                      static_cast<Uint16>(c));
+}
+
+int GlyphAtlas::measure(const std::string &text) const {
+  int width = 0;
+  char previous = 0;
+  for (char c : text) {
+    if (previous)
+      width += kerning(previous, c);
+    width += glyph(c).advance;
+    previous = c;
+  }
+  return width;
+}
+
+void GlyphAtlas::appendQuads(const std::string &text, float x, float y,
+                             SDL_Color color, std::vector<SDL_Vertex> &vertices,
+                             std::vector<int> &indices) const {
+  const float invWidth = 1.0f / static_cast<float>(m_width);
+  const float invHeight = 1.0f / static_cast<float>(m_height);
+  float penX = x;
+  char previous = 0;
+  for (char c : text) {
+    if (previous)
+      penX += static_cast<float>(kerning(previous, c));
+    const Glyph &g = glyph(c);
+    if (g.src.w > 0) {
+      const float x1 = penX + static_cast<float>(g.src.w);
+      const float y1 = y + static_cast<float>(g.src.h);
+      const float u0 = static_cast<float>(g.src.x) * invWidth;
+      const float v0 = static_cast<float>(g.src.y) * invHeight;
+      const float u1 = static_cast<float>(g.src.x + g.src.w) * invWidth;
+      const float v1 = static_cast<float>(g.src.y + g.src.h) * invHeight;
+
+      const int base = static_cast<int>(vertices.size());
+      vertices.push_back({{penX, y}, color, {u0, v0}});
+      vertices.push_back({{x1, y}, color, {u1, v0}});
+      vertices.push_back({{penX, y1}, color, {u0, v1}});
+      vertices.push_back({{x1, y1}, color, {u1, v1}});
+      for (int corner : {0, 1, 2, 2, 1, 3})
+        indices.push_back(base + corner);
+    }
+    penX += static_cast<float>(g.advance);
+    previous = c;
+  }
+}
+
+} // namespace Engine
@@ -0,0 +1,75 @@
+#pragma once
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+/**
+ * @brief One texture page holding every printable ASCII glyph of a font.
+ *
+ * Glyphs are rasterized once, in white, and shelf-packed into a single
+ * texture. A string then becomes one textured quad per character whose
+ * vertex color supplies the text color and alpha, so any number of strings
+ * in any colors can be drawn from the same texture without re-rendering.
+ *
+ * Characters outside FIRST_CHAR..LAST_CHAR are not in the page; callers
+ * check covers() and fall back to TTF rendering for such strings.
+ */
+class GlyphAtlas {
+public:
+  static constexpr char FIRST_CHAR = ' ';
+  static constexpr char LAST_CHAR = '~';
+
+  /**
+   * @throws std::runtime_error if a glyph cannot be rendered or the page
+   *         cannot be created.
+   */
+  GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font);
+  ~GlyphAtlas();
+
+  // No copy
+  GlyphAtlas(const GlyphAtlas &) = delete;
+  GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+  [[nodiscard]] SDL_Renderer *getRenderer() const { return m_renderer; }
+  [[nodiscard]] SDL_Texture *getTexture() const { return m_texture; }
+  [[nodiscard]] int getLineHeight() const { return m_lineHeight; }
+
+  // True when every character of `text` is in the page.
+  [[nodiscard]] bool covers(const std::string &text) const;
+
+  // Pixel width of `text` (advances plus kerning); text must be covered.
+  [[nodiscard]] int measure(const std::string &text) const;
+
+  /**
+   * @brief Appends 4 vertices and 6 indices per visible glyph of `text`,
+   * with its top-left corner at (x, y). Text must be covered.
+   */
+  void appendQuads(const std::string &text, float x, float y, SDL_Color color,
+                   std::vector<SDL_Vertex> &vertices,
+                   std::vector<int> &indices) const;
+
+private:
+  struct Glyph {
+    SDL_Rect src; // Location in the page (w = 0 for blank glyphs)
+    int advance;
+  };
+
+  [[nodiscard]] const Glyph &glyph(char c) const {
+    return m_glyphs[static_cast<unsigned char>(c) - FIRST_CHAR];
+  }
+  [[nodiscard]] int kerning(char previous, char c) const;
+
+  SDL_Renderer *m_renderer;
+  TTF_Font *m_font;
+  SDL_Texture *m_texture;
+  int m_width;
+  int m_height;
+  int m_lineHeight;
+  std::array<Glyph, LAST_CHAR - FIRST_CHAR + 1> m_glyphs;
+};
+
+} // namespace Engine
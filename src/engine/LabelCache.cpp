@@ -0,0 +1,30 @@
+#include "LabelCache.hpp"
+#include "Font.hpp"
+#include "Renderer.hpp"
+#include <iostream>
+#include <string>
+
+namespace Engine {
+
+const Texture *LabelCache::get(Renderer &renderer, int value, const Font &font,
+                               uint8_t r, uint8_t g, uint8_t b) {
+  const Key key{value, &font,
+                static_cast<std::uint32_t>(r) << 16 |
+                    static_cast<std::uint32_t>(g) << 8 | b};
+  auto it = m_labels.find(key);
+  if (it != m_labels.end())
+    return &it->second;
+
+  try {
+    it = m_labels
+             .emplace(key, Texture(renderer, font, std::to_string(value),
+                                   SDL_Color{r, g, b, 255}))
+             .first;
+  } catch (const std::exception &e) {
+    std::cerr << "Label Render Error: " << e.what() << std::endl;
+    return nullptr;
+  }
+  return &it->second;
+}
+
+} // namespace Engine
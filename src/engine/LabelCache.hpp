@@ -0,0 +1,53 @@
+#pragma once
+#include "Texture.hpp"
+#include <SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+namespace Engine {
+
+class Font;
+class Renderer;
+
+/**
+ * @brief Pre-rendered number labels (tile values), one texture per
+ * (value, font, color).
+ *
+ * A label is rendered on first use and then reused, so drawing a board of
+ * cached values rasterizes no text and builds no strings. Colors are part
+ * of the key; clear() drops everything, e.g. when the color theme changes.
+ */
+class LabelCache {
+public:
+  /**
+   * @brief Texture showing `value` in `font` and the given color.
+   * Returns nullptr if the label cannot be rendered.
+   */
+  const Texture *get(Renderer &renderer, int value, const Font &font,
+                     uint8_t r, uint8_t g, uint8_t b);
+
+  void clear() { m_labels.clear(); }
+  [[nodiscard]] std::size_t size() const { return m_labels.size(); }
+
+private:
+  struct Key {
+    int value;
+    const Font *font;
+    std::uint32_t rgb;
+    bool operator==(const Key &other) const = default;
+  };
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const {
+      const std::uint64_t mixed =
+          (static_cast<std::uint64_t>(key.value) << 24 | key.rgb) *
+              0x9E3779B97F4A7C15ULL ^
+          reinterpret_cast<std::uintptr_t>(key.font);
+      return static_cast<std::size_t>(mixed ^ (mixed >> 29));
+    }
+  };
+
+  std::unordered_map<Key, Texture, KeyHash> m_labels;
+};
+
+} // namespace Engine
@@ -28,8 +28,16 @@ Renderer::~Renderer() {
   }
 }
 
-Renderer::Renderer(Renderer &&other) noexcept : renderer(other.renderer) {
+Renderer::Renderer(Renderer &&other) noexcept
+    : renderer(other.renderer), frameStats(other.frameStats),
+      lastFrameStats(other.lastFrameStats), boundTexture(other.boundTexture),
+      batchTexture(other.batchTexture),
+      batchVertices(std::move(other.batchVertices)),
+      batchIndices(std::move(other.batchIndices)),
+      textVertices(std::move(other.textVertices)),
+      textIndices(std::move(other.textIndices)) {
   other.renderer = nullptr;
+  other.batchTexture = nullptr;
 }
 
 Renderer &Renderer::operator=(Renderer &&other) noexcept {
@@ -37,98 +45,169 @@ Renderer &Renderer::operator=(Renderer &&other) noexcept {
     if (renderer)
       SDL_DestroyRenderer(renderer);
     renderer = other.renderer;
+    frameStats = other.frameStats;
+    lastFrameStats = other.lastFrameStats;
+    boundTexture = other.boundTexture;
+    batchTexture = other.batchTexture;
+    batchVertices = std::move(other.batchVertices);
+    batchIndices = std::move(other.batchIndices);
+    textVertices = std::move(other.textVertices);
+    textIndices = std::move(other.textIndices);
     other.renderer = nullptr;
+    other.batchTexture = nullptr;
   }
   return *this;
 }
 
-void Renderer::clear() { SDL_RenderClear(renderer); }
+void Renderer::clear() {
+  flushSprites();
+  SDL_RenderClear(renderer);
+}
 
-void Renderer::present() { SDL_RenderPresent(renderer); }
+void Renderer::present() {
+  flushSprites();
+  SDL_RenderPresent(renderer);
+  lastFrameStats = frameStats;
+  frameStats = {};
+}
+
+void Renderer::countDraw(SDL_Texture *texture) {
+  ++frameStats.drawCalls;
+  if (texture && texture != boundTexture)
+    ++frameStats.textureBinds;
+  boundTexture = texture;
+}
 
 void Renderer::setDrawColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
   SDL_SetRenderDrawColor(renderer, r, g, b, a);
 }
 
 void Renderer::drawFillRect(int x, int y, int w, int h) {
+  flushSprites();
   SDL_Rect rect;
   rect.x = x;
   rect.y = y;
   rect.w = w;
   rect.h = h;
+  countDraw(nullptr);
   SDL_RenderFillRect(renderer, &rect);
 }
 
 void Renderer::drawText(const std::string &text, const Font &font, int x, int y,
                         uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
-  SDL_Color color = {r, g, b, a};
-  SDL_Surface *surface =
-      TTF_RenderText_Blended(font.getNativeHandle(), text.c_str(), color);
-  if (!surface) {
-    // Handle error (log it)
-    std::cerr << "TTF Render Error: " << TTF_GetError() << std::endl;
+  flushSprites();
+  const GlyphAtlas *atlas = font.getAtlas(renderer);
+  if (atlas && atlas->covers(text)) {
+    drawTextQuads(*atlas, text, x, y, {r, g, b, a});
     return;
   }
+  rasterizeText(text, font, x, y, false, {r, g, b, a});
+}
 
-  SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
-  if (!texture) {
-    std::cerr << "Texture Create Error: " << SDL_GetError() << std::endl;
-    SDL_FreeSurface(surface);
+void Renderer::drawTextCentered(const std::string &text, const Font &font,
+                                int cx, int cy, uint8_t r, uint8_t g, uint8_t b,
+                                uint8_t a) {
+  flushSprites();
+  const GlyphAtlas *atlas = font.getAtlas(renderer);
+  if (atlas && atlas->covers(text)) {
+    drawTextQuads(*atlas, text, cx - atlas->measure(text) / 2,
+                  cy - atlas->getLineHeight() / 2, {r, g, b, a});
     return;
   }
+  rasterizeText(text, font, cx, cy, true, {r, g, b, a});
+}
 
-  SDL_Rect dest;
-  dest.x = x;
-  dest.y = y;
-  dest.w = surface->w;
-  dest.h = surface->h;
-
-  SDL_RenderCopy(renderer, texture, nullptr, &dest);
+void Renderer::batchSprite(const Texture &texture, const SDL_Rect &dstRect,
+                           uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+  if (texture.get() != batchTexture)
+    flushSprites();
+  batchTexture = texture.get();
+
+  const SDL_Color color = {r, g, b, a};
+  const auto x0 = static_cast<float>(dstRect.x);
+  const auto y0 = static_cast<float>(dstRect.y);
+  const auto x1 = static_cast<float>(dstRect.x + dstRect.w);
+  const auto y1 = static_cast<float>(dstRect.y + dstRect.h);
+  const int base = static_cast<int>(batchVertices.size());
+  batchVertices.push_back({{x0, y0}, color, {0.0f, 0.0f}});
+  batchVertices.push_back({{x1, y0}, color, {1.0f, 0.0f}});
+  batchVertices.push_back({{x0, y1}, color, {0.0f, 1.0f}});
+  batchVertices.push_back({{x1, y1}, color, {1.0f, 1.0f}});
+  for (int corner : {0, 1, 2, 2, 1, 3})
+    batchIndices.push_back(base + corner);
+}
 
-  SDL_DestroyTexture(texture);
-  SDL_FreeSurface(surface);
+void Renderer::flushSprites() {
+  if (!batchIndices.empty()) {
+    countDraw(batchTexture);
+    SDL_RenderGeometry(renderer, batchTexture, batchVertices.data(),
+                       static_cast<int>(batchVertices.size()),
+                       batchIndices.data(),
+                       static_cast<int>(batchIndices.size()));
+  }
+  batchTexture = nullptr;
+  batchVertices.clear();
+  batchIndices.clear();
 }
 
-void Renderer::drawTextCentered(const std::string &text, const Font &font,
-                                int cx, int cy, uint8_t r, uint8_t g, uint8_t b,
-                                uint8_t a) {
-  SDL_Color color = {r, g, b, a};
+void Renderer::drawTextQuads(const GlyphAtlas &atlas, const std::string &text,
+                             int x, int y, SDL_Color color) {
+  // Buffers are reused, so steady-state text drawing does not allocate
+  textVertices.clear();
+  textIndices.clear();
+  atlas.appendQuads(text, static_cast<float>(x), static_cast<float>(y), color,
+                    textVertices, textIndices);
+  if (textIndices.empty())
+    return;
+  countDraw(atlas.getTexture());
+  SDL_RenderGeometry(renderer, atlas.getTexture(), textVertices.data(),
+                     static_cast<int>(textVertices.size()), textIndices.data(),
+                     static_cast<int>(textIndices.size()));
+}
 
-  // Render to surface to get dimensions
+void Renderer::rasterizeText(const std::string &text, const Font &font, int x,
+                             int y, bool centered, SDL_Color color) {
+  ++frameStats.textRasterizations;
   SDL_Surface *surface =
       TTF_RenderText_Blended(font.getNativeHandle(), text.c_str(), color);
   if (!surface) {
+    // Handle error (log it)
+    std::cerr << "TTF Render Error: " << TTF_GetError() << std::endl;
     return;
   }
 
-  int w = surface->w;
-  int h = surface->h;
-
   SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
   if (!texture) {
+    std::cerr << "Texture Create Error: " << SDL_GetError() << std::endl;
     SDL_FreeSurface(surface);
     return;
   }
+  ++frameStats.texturesCreated;
 
-  // Centering Logic
   SDL_Rect dest;
-  dest.x = cx - (w / 2);
-  dest.y = cy - (h / 2);
-  dest.w = w;
-  dest.h = h;
+  dest.x = centered ? x - surface->w / 2 : x;
+  dest.y = centered ? y - surface->h / 2 : y;
+  dest.w = surface->w;
+  dest.h = surface->h;
 
+  countDraw(texture);
   SDL_RenderCopy(renderer, texture, nullptr, &dest);
 
   SDL_DestroyTexture(texture);
+  ++frameStats.texturesDestroyed;
   SDL_FreeSurface(surface);
 }
 
 void Renderer::drawTexture(const Texture &texture, const SDL_Rect &dstRect) {
+  flushSprites();
+  countDraw(texture.get());
   SDL_RenderCopy(renderer, texture.get(), NULL, &dstRect);
 }
 
 void Renderer::drawTexture(const Texture &texture, const SDL_Rect &srcRect,
                            const SDL_Rect &dstRect) {
+  flushSprites();
+  countDraw(texture.get());
   SDL_RenderCopy(renderer, texture.get(), &srcRect, &dstRect);
 }
 
@@ -4,6 +4,7 @@
 #include "Tile.hpp"
 #include "Window.hpp"
 #include <SDL.h>
+#include <vector>
 
 namespace Engine {
 
@@ -11,6 +12,19 @@ struct Color {
   uint8_t r, g, b, a;
 };
 
+/**
+ * @brief Work submitted through a Renderer during one frame (present() to
+ * present()). Drawing done directly on getInternal() is not seen.
+ */
+struct FrameStats {
+  int drawCalls = 0;          // Fill, copy and geometry submissions
+  int textureBinds = 0;       // Draws using a different texture than the last
+  int stateChanges = 0;       // Texture color/alpha/blend mode changes
+  int textRasterizations = 0; // Strings rendered with SDL_ttf
+  int texturesCreated = 0;
+  int texturesDestroyed = 0;
+};
+
 class Renderer {
 public:
   explicit Renderer(const Window &window, int logicalWidth, int logicalHeight);
@@ -26,6 +40,11 @@ public:
 
   [[nodiscard]] SDL_Renderer *getInternal() const { return renderer; }
 
+  // Counters of the last presented frame
+  [[nodiscard]] const FrameStats &getFrameStats() const {
+    return lastFrameStats;
+  }
+
   // Drawing Primitives
   void clear();
   void present();
@@ -34,7 +53,17 @@ public:
   void drawTexture(const Texture &texture, const SDL_Rect &dstRect);
   void drawTexture(const Texture &texture, const SDL_Rect &srcRect,
                    const SDL_Rect &dstRect); // Added overload
-  // Text Rendering
+  // Sprite batching: quads of the whole texture, tinted per vertex, are
+  // queued and submitted with one SDL_RenderGeometry call per texture run.
+  // Queuing a different texture or any immediate draw call flushes first, so
+  // draw order is preserved. Texture color/alpha modulation is not applied.
+  // The texture must stay alive until the batch is flushed.
+  void batchSprite(const Texture &texture, const SDL_Rect &dstRect, uint8_t r,
+                   uint8_t g, uint8_t b, uint8_t a = 255);
+  void flushSprites();
+
+  // Text Rendering: printable ASCII comes from the font's GlyphAtlas (one
+  // textured draw per string), anything else is rasterized with SDL_ttf
   void drawText(const std::string &text, const Font &font, int x, int y,
                 uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 
@@ -43,7 +72,24 @@ public:
                         int cy, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 
 private:
+  friend class Texture; // Reports creation, destruction and state changes
+
+  void countDraw(SDL_Texture *texture);
+  void drawTextQuads(const GlyphAtlas &atlas, const std::string &text, int x,
+                     int y, SDL_Color color);
+  // Per-call TTF_RenderText_Blended path (non-ASCII text)
+  void rasterizeText(const std::string &text, const Font &font, int x, int y,
+                     bool centered, SDL_Color color);
+
   SDL_Renderer *renderer;
+  FrameStats frameStats;     // Frame being drawn
+  FrameStats lastFrameStats; // Frame last presented
+  SDL_Texture *boundTexture = nullptr; // Texture of the last draw
+  SDL_Texture *batchTexture = nullptr;   // Texture of the queued quads
+  std::vector<SDL_Vertex> batchVertices; // Kept between frames
+  std::vector<int> batchIndices;
+  std::vector<SDL_Vertex> textVertices; // Scratch, reused between calls
+  std::vector<int> textIndices;
 };
 
 } // namespace Engine
@@ -1,4 +1,5 @@
 #include "Texture.hpp"
+#include "Font.hpp"
 #include "Renderer.hpp"
 #include <SDL_image.h>
 #include <stdexcept>
@@ -6,7 +7,7 @@
 namespace Engine {
 
 Texture::Texture(Renderer &renderer, const std::string &path)
-    : m_texture(nullptr), m_width(0), m_height(0) {
+    : m_renderer(&renderer), m_texture(nullptr), m_width(0), m_height(0) {
 
   SDL_Surface *surface = IMG_Load(path.c_str());
   if (!surface) {
@@ -20,6 +21,7 @@ Texture::Texture(Renderer &renderer, const std::string &path)
                              std::string(SDL_GetError()));
   }
 
+  ++renderer.frameStats.texturesCreated;
   m_width = surface->w;
   m_height = surface->h;
   SDL_FreeSurface(surface);
@@ -27,7 +29,7 @@ Texture::Texture(Renderer &renderer, const std::string &path)
 
 Texture::Texture(Renderer &renderer, const std::string &path, uint8_t r,
                  uint8_t g, uint8_t b, int threshold)
-    : m_texture(nullptr), m_width(0), m_height(0) {
+    : m_renderer(&renderer), m_texture(nullptr), m_width(0), m_height(0) {
 
   SDL_Surface *surface = IMG_Load(path.c_str());
   if (!surface) {
@@ -79,28 +81,58 @@ Texture::Texture(Renderer &renderer, const std::string &path, uint8_t r,
     throw std::runtime_error("Failed to create texture from surface: " + path);
   }
 
+  ++renderer.frameStats.texturesCreated;
   m_width = surface->w;
   m_height = surface->h;
 
   SDL_FreeSurface(surface);
 }
 
+Texture::Texture(Renderer &renderer, const Font &font, const std::string &text,
+                 SDL_Color color)
+    : m_renderer(&renderer), m_texture(nullptr), m_width(0), m_height(0) {
+
+  ++renderer.frameStats.textRasterizations;
+  SDL_Surface *surface =
+      TTF_RenderText_Blended(font.getNativeHandle(), text.c_str(), color);
+  if (!surface) {
+    throw std::runtime_error("Failed to render text '" + text +
+                             "': " + std::string(TTF_GetError()));
+  }
+
+  m_texture = SDL_CreateTextureFromSurface(renderer.getInternal(), surface);
+  if (!m_texture) {
+    SDL_FreeSurface(surface);
+    throw std::runtime_error("CreateTexture failed: " +
+                             std::string(SDL_GetError()));
+  }
+
+  ++renderer.frameStats.texturesCreated;
+  m_width = surface->w;
+  m_height = surface->h;
+  SDL_FreeSurface(surface);
+}
+
 Texture::~Texture() {
   if (m_texture) {
     SDL_DestroyTexture(m_texture);
+    ++m_renderer->frameStats.texturesDestroyed;
   }
 }
 
 Texture::Texture(Texture &&other) noexcept
-    : m_texture(other.m_texture), m_width(other.m_width),
-      m_height(other.m_height) {
+    : m_renderer(other.m_renderer), m_texture(other.m_texture),
+      m_width(other.m_width), m_height(other.m_height) {
   other.m_texture = nullptr;
 }
 
 Texture &Texture::operator=(Texture &&other) noexcept {
   if (this != &other) {
-    if (m_texture)
+    if (m_texture) {
       SDL_DestroyTexture(m_texture);
+      ++m_renderer->frameStats.texturesDestroyed;
+    }
+    m_renderer = other.m_renderer;
     m_texture = other.m_texture;
     m_width = other.m_width;
     m_height = other.m_height;
@@ -110,14 +142,20 @@ Texture &Texture::operator=(Texture &&other) noexcept {
 }
 
 void Texture::setColor(uint8_t r, uint8_t g, uint8_t b) {
-  if (m_texture)
+  if (m_texture) {
     SDL_SetTextureColorMod(m_texture, r, g, b);
+    ++m_renderer->frameStats.stateChanges;
+  }
 }
 
-void Texture::setAlpha(uint8_t a) { SDL_SetTextureAlphaMod(m_texture, a); }
+void Texture::setAlpha(uint8_t a) {
+  SDL_SetTextureAlphaMod(m_texture, a);
+  ++m_renderer->frameStats.stateChanges;
+}
 
 void Texture::setBlendMode(SDL_BlendMode blending) {
   SDL_SetTextureBlendMode(m_texture, blending);
+  ++m_renderer->frameStats.stateChanges;
 }
 
 } // namespace Engine
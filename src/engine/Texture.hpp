@@ -5,7 +5,10 @@
 namespace Engine {
 
 class Renderer; // Forward declaration
+class Font;
 
+// Textures report to the Renderer that created them (see FrameStats), so
+// that Renderer must outlive them and must not be moved while they exist.
 class Texture {
 public:
   // Constructor loads texture from file
@@ -15,6 +18,9 @@ public:
   // anti-aliased or noisy backgrounds)
   Texture(Renderer &renderer, const std::string &path, uint8_t r, uint8_t g,
           uint8_t b, int threshold = 0);
+  // Constructor rendering a line of text once (TTF blended)
+  Texture(Renderer &renderer, const Font &font, const std::string &text,
+          SDL_Color color);
   ~Texture();
 
   // No copy
@@ -35,6 +41,7 @@ public:
   void setBlendMode(SDL_BlendMode blending); // NEW for Additive Blending
 
 private:
+  Renderer *m_renderer;
   SDL_Texture *m_texture;
   int m_width;
   int m_height;
@@ -17,7 +17,10 @@ Game::Game()
       m_fontTiny("assets/ClearSans-Bold.ttf",
                  14), // Compact Labels (Smaller to fit)
       m_fontMedium("assets/ClearSans-Bold.ttf", 30), // Score Values
-      m_inputManager(), m_grid(), m_logic(), m_isRunning(true),
+      m_inputManager(), m_grid(), m_logic(),
+      m_rng(Core::Rng::fromEntropy()),
+      m_hintWorker({.onResult = [this] { m_inputManager.wake(); }}),
+      m_hintRequested(false), m_isRunning(true),
       m_state(GameState::MainMenu), m_previousState(GameState::MainMenu),
       m_menuSelection(0), m_darkSkin(false), m_soundOn(true), m_score(0),
       m_bestScore(0), m_showAchievementPopup(false),
@@ -291,11 +294,21 @@ void Game::run() {
 
     handleInput();
     update(dt);
-    render();
+    if (m_sceneDirty) {
+      m_sceneDirty = false;
+      render();
+    }
 
-    // Cap at ~60 FPS (Optional, vsync is better but simple delay works)
-    if (dt < 16) {
-      SDL_Delay(16 - dt);
+    if (isSceneAnimated()) {
+      // Cap at ~60 FPS (Optional, vsync is better but simple delay works)
+      if (dt < 16) {
+        SDL_Delay(16 - dt);
+      }
+    } else {
+      // Nothing moves on its own: sleep until input (or a hint) arrives.
+      // The wait is not frame time, so the next animation starts at dt ~0.
+      m_inputManager.waitForEvent(IDLE_WAIT_MS);
+      lastTime = SDL_GetTicks64();
     }
   }
 
@@ -306,12 +319,19 @@ void Game::handleInput() {
   int mx = 0, my = 0;
   bool clicked = false;
   Action action = m_inputManager.pollAction(mx, my, clicked);
+  if (m_inputManager.sawSceneEvent())
+    m_sceneDirty = true; // Keys, clicks, window exposure
 
   if (action == Action::Quit) {
     m_isRunning = false;
     return;
   }
 
+  if (action == Action::ToggleStats) {
+    m_showFrameStats = !m_showFrameStats;
+    return;
+  }
+
   // Specific Handling for Playing State Buttons (Global check simplifies
   // things if state matches)
   if (m_state == GameState::Playing && clicked) {
@@ -321,6 +341,11 @@ void Game::handleInput() {
       resetGame();
       return;
     }
+    // Hint: X=240, Y=120, W=120, H=40
+    if (mx >= 240 && mx <= 360 && my >= 120 && my <= 160) {
+      requestHint();
+      return;
+    }
     // Options: X=460, Y=120, W=130, H=40
     if (mx >= 460 && mx <= 590 && my >= 120 && my <= 160) {
       m_previousState = GameState::Playing; // Track history
@@ -415,10 +440,11 @@ void Game::handleInputMenu(Action action, int mx, int my, bool clicked) {
       m_state = GameState::Playing;
       m_soundManager.playOneShot("start", 64);
       resetGame();
-      m_grid.spawnRandomTile(); // Ensure 2 tiles at start
+      m_grid.spawnRandomTile(m_rng); // Ensure 2 tiles at start
       break;
     case 1: // Load
       if (PersistenceManager::loadGame(m_grid, m_score)) {
+        clearHint();
         m_state = GameState::Playing;
         m_soundManager.playOneShot("start", 64);
       } else {
@@ -553,6 +579,7 @@ void Game::handleInputOptions(Action action, int mx, int my, bool clicked) {
     switch (m_menuSelection) {
     case 0: // Skin
       m_darkSkin = !m_darkSkin;
+      m_tileLabels.clear(); // Labels are keyed by the old theme's colors
       break;
     case 1: // Sound
       m_soundOn = !m_soundOn;
@@ -670,6 +697,11 @@ void Game::handleInputPlaying(Action action, int mx, int my, bool clicked) {
     return;
   }
 
+  if (action == Action::Hint) {
+    requestHint();
+    return;
+  }
+
   if (action == Action::None || action == Action::Quit ||
       action == Action::Restart || action == Action::Confirm)
     return;
@@ -686,18 +718,34 @@ void Game::handleInputPlaying(Action action, int mx, int my, bool clicked) {
   else
     return;
 
-  // Execute Logic with MoveEvents
-  // Execute Logic with MoveEvents
-  auto result = m_logic.move(m_grid, dir);
+  // Invalid Move -> Shake (checked on the board itself, nothing is moved)
+  if (!(Core::GameLogic::legalMoves(m_grid) &
+        Core::GameLogic::directionBit(dir))) {
+    m_soundManager.playOneShot("invalid");
+
+    Animation shakeAnim;
+    shakeAnim.type = Animation::Type::Shake;
+    shakeAnim.duration = 0.3f;
+    shakeAnim.shakeOffsetX = 10.0f; // 10px shake magnitude
+
+    m_animationManager.addAnimation(shakeAnim);
+    m_state = GameState::Animating; // Block input while shaking
+    return;
+  }
+
+  // Execute Logic with MoveEvents (inline buffer, no allocation)
+  Core::GameLogic::MoveEventBuffer events;
+  auto result = m_logic.move(m_grid, dir, events);
 
   if (result.moved) {
+    clearHint(); // Stale for the new board
     m_score += result.score;
     if (m_score > m_bestScore)
       m_bestScore = m_score;
 
     // Process Events for Animation
     bool hasAnimations = false;
-    for (const auto &evt : result.events) {
+    for (const auto &evt : events) {
       SDL_Rect fromRect = getTileRect(evt.fromX, evt.fromY); // Pixel Coords
       SDL_Rect toRect = getTileRect(evt.toX, evt.toY);
 
@@ -751,7 +799,7 @@ void Game::handleInputPlaying(Action action, int mx, int my, bool clicked) {
     }
 
     // SPAWN NEW TILE
-    auto [sx, sy] = m_grid.spawnRandomTile();
+    auto [sx, sy] = m_grid.spawnRandomTile(m_rng);
     if (sx != -1) {
       // Sound: Spawn
       m_soundManager.play("spawn");
@@ -787,23 +835,15 @@ void Game::handleInputPlaying(Action action, int mx, int my, bool clicked) {
         m_menuSelection = 0;
       }
     }
-  } else {
-    // Invalid Move -> Shake
-    m_soundManager.playOneShot("invalid");
-
-    Animation shakeAnim;
-    shakeAnim.type = Animation::Type::Shake;
-    shakeAnim.duration = 0.3f;
-    shakeAnim.shakeOffsetX = 10.0f; // 10px shake magnitude
-
-    m_animationManager.addAnimation(shakeAnim);
-    m_state = GameState::Animating; // Block input while shaking
   }
 }
 
 void Game::update(float dt) { // Added dt
   m_soundManager.update();    // Reset One-Shot flags
 
+  // Last frame of an animation or popup still needs drawing at rest
+  const bool wasAnimated = isSceneAnimated();
+
   // Animation State Handling
   m_animationManager.update(
       dt /
@@ -812,6 +852,14 @@ void Game::update(float dt) { // Added dt
   // Check Achievements
   checkAchievements();
 
+  // Hint mailbox (never blocks; the worker keeps deepening meanwhile)
+  if (m_hintRequested) {
+    if (auto hint = m_hintWorker.poll(); hint && hint != m_hint) {
+      m_hint = hint;
+      m_sceneDirty = true;
+    }
+  }
+
   // Popup Timer
   if (m_showAchievementPopup) {
     m_popupTimer -= dt / 1000.0f;
@@ -857,6 +905,15 @@ void Game::update(float dt) { // Added dt
   default:
     break;
   }
+
+  if (wasAnimated || isSceneAnimated())
+    m_sceneDirty = true;
+}
+
+bool Game::isSceneAnimated() const {
+  return m_animationManager.isAnimating() || m_showAchievementPopup ||
+         m_state == GameState::Animating ||
+         m_state == GameState::BestScores; // Pulsing leaderboard
 }
 
 void Game::render() {
@@ -898,9 +955,33 @@ void Game::render() {
     renderAchievementPopup();
   }
 
+  if (m_showFrameStats) {
+    renderFrameStats();
+  }
+
   m_renderer.present();
 }
 
+void Game::renderFrameStats() {
+  // Counters of the previous frame (this one is still being drawn)
+  const Engine::FrameStats &s = m_renderer.getFrameStats();
+  const std::string lines[] = {
+      "draws " + std::to_string(s.drawCalls) + "  binds " +
+          std::to_string(s.textureBinds) + "  mods " +
+          std::to_string(s.stateChanges),
+      "text " + std::to_string(s.textRasterizations) + "  tex +" +
+          std::to_string(s.texturesCreated) + " -" +
+          std::to_string(s.texturesDestroyed)};
+
+  m_renderer.setDrawColor(0, 0, 0, 255);
+  m_renderer.drawFillRect(0, 0, 260, 44);
+  int y = 2;
+  for (const std::string &line : lines) {
+    m_renderer.drawText(line, m_fontSmall, 6, y, 255, 255, 255, 255);
+    y += 20;
+  }
+}
+
 void Game::renderMenu() {
   // Phase R: Removed renderGridBackground() to fix "grey placeholders" clutter.
   // The menu is now cleaner on top of the plain window background.
@@ -1296,6 +1377,20 @@ void Game::renderPlaying() {
   m_renderer.drawText("Options", m_fontMedium, 460, toolbarY + 5, btnColor.r,
                       btnColor.g, btnColor.b, 255);
 
+  // Hint label doubles as the result: direction and search depth reached
+  static constexpr const char *DIRECTION_NAMES[] = {"Up", "Down", "Left",
+                                                    "Right"};
+  std::string hintLabel = "Hint";
+  if (m_hint) {
+    hintLabel = std::string(DIRECTION_NAMES[static_cast<int>(m_hint->move)]) +
+                " (" + std::to_string(m_hint->depth) + ")";
+  } else if (m_hintRequested) {
+    hintLabel = "Hint...";
+  }
+  m_renderer.drawTextCentered(hintLabel, m_fontMedium, WINDOW_WIDTH / 2,
+                              toolbarY + 20, btnColor.r, btnColor.g,
+                              btnColor.b, 255);
+
   // Rounded Box for buttons visual cue? (Optional)
   // SDL_Rect rBtn = {20, toolbarY, 100, 40};
   // SDL_Rect oBtn = {480, toolbarY, 100, 40};
@@ -1325,40 +1420,44 @@ void Game::renderPlaying() {
 
   // Background Removed (Transparent Board) but logic remains here
 
-  // 3. Render Tiles
-  for (int y = 0; y < 4; ++y) {
-    for (int x = 0; x < 4; ++x) {
-      // SKIP rendering if this tile is currently being animated (target of
-      // animation) Note: We hide the TARGET of the slide.
-      if (m_hiddenTiles.count({x, y}))
-        continue;
-
-      Core::Tile tile = m_grid.getTile(x, y);
-
-      SDL_Rect rect = getTileRect(x, y); // Use the helper
-      rect.x += shakeX;                  // Apply Shake
-
-      Color c =
-          tile.isEmpty() ? getEmptyTileColor() : getTileColor(tile.getValue());
-
-      if (m_tileTexture) {
-        m_tileTexture->setColor(c.r, c.g, c.b);
-        m_renderer.drawTexture(*m_tileTexture, rect);
-      } else {
-        m_renderer.setDrawColor(c.r, c.g, c.b, c.a);
-        m_renderer.drawFillRect(rect.x, rect.y, rect.w, rect.h);
-      }
-
-      if (!tile.isEmpty()) {
-        Color tc = getTextColor(tile.getValue());
-        m_renderer.drawTextCentered(std::to_string(tile.getValue()), m_font,
-                                    rect.x + rect.w / 2, rect.y + rect.h / 2,
-                                    tc.r, tc.g, tc.b, tc.a);
+  // 3. Render Tiles: bodies first (one batched draw), then their labels
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 4; ++x) {
+        // SKIP rendering if this tile is currently being animated (target of
+        // animation) Note: We hide the TARGET of the slide.
+        if (m_hiddenTiles.count({x, y}))
+          continue;
+
+        Core::Tile tile = m_grid.getTile(x, y);
+
+        SDL_Rect rect = getTileRect(x, y); // Use the helper
+        rect.x += shakeX;                  // Apply Shake
+
+        if (pass == 0) {
+          drawTileBody(tile.isEmpty() ? getEmptyTileColor()
+                                      : getTileColor(tile.getValue()),
+                       rect);
+        } else if (!tile.isEmpty()) {
+          drawTileLabel(tile.getValue(), rect);
+        }
       }
     }
+    m_renderer.flushSprites();
+  }
+
+  // 3.5 Hinted direction
+  renderHint(shakeX);
+
+  // 4. Render Animations (Slide/Spawn/Merge/Score): tile bodies in one
+  // batched draw, then labels and floating scores on top
+  for (const auto &anim : m_animationManager.getAnimations()) {
+    if (anim.type != Animation::Type::Shake &&
+        anim.type != Animation::Type::Score)
+      drawTileBody(getTileColor(anim.value), getAnimatedTileRect(anim, shakeX));
   }
+  m_renderer.flushSprites();
 
-  // 4. Render Animations (Slide/Spawn/Merge/Score)
   for (const auto &anim : m_animationManager.getAnimations()) {
     if (anim.type == Animation::Type::Shake)
       continue; // Skip shake logic
@@ -1389,47 +1488,8 @@ void Game::renderPlaying() {
       continue;
     }
 
-    // Slide/Spawn Logic
-    float t = anim.getProgress();
-    float curX = anim.startX + (anim.endX - anim.startX) * t;
-    float curY = anim.startY + (anim.endY - anim.startY) * t;
-
-    // Scaling for Spawn
-    float curScale = anim.startScale + (anim.endScale - anim.startScale) * t;
-
-    SDL_Rect r;
-    SDL_Rect sz = getTileRect(0, 0); // Base size
-    int w = static_cast<int>(sz.w * curScale);
-    int h = static_cast<int>(sz.h * curScale);
-
-    // Center the scaled rect
-    int finalX = (int)curX + (sz.w - w) / 2 + shakeX; // Apply Shake
-    int finalY = (int)curY + (sz.h - h) / 2;
-
-    r.x = finalX;
-    r.y = finalY;
-    r.w = w;
-    r.h = h;
-
-    // Render
-    Color c = getTileColor(anim.value);
-
-    // Alpha for Merge?
-    // Just solid for now.
-
-    if (m_tileTexture) {
-      m_tileTexture->setColor(c.r, c.g, c.b);
-      m_renderer.drawTexture(*m_tileTexture, r);
-    } else {
-      m_renderer.setDrawColor(c.r, c.g, c.b, 255);
-      m_renderer.drawFillRect(r.x, r.y, r.w, r.h);
-    }
-
-    // Text
-    Color tc = getTextColor(anim.value);
-    m_renderer.drawTextCentered(std::to_string(anim.value), m_font,
-                                r.x + r.w / 2, r.y + r.h / 2, tc.r, tc.g, tc.b,
-                                255);
+    // Slide/Spawn Text (bodies were batched above)
+    drawTileLabel(anim.value, getAnimatedTileRect(anim, shakeX));
   }
 
   // 5. Back Button (Glass Style)
@@ -1558,18 +1618,10 @@ void Game::renderGridBackground() {
 
   for (int y = 0; y < 4; ++y) {
     for (int x = 0; x < 4; ++x) {
-      SDL_Rect rect = getTileRect(x, y);
-      Color c = getEmptyTileColor();
-
-      if (m_tileTexture) {
-        m_tileTexture->setColor(c.r, c.g, c.b);
-        m_renderer.drawTexture(*m_tileTexture, rect);
-      } else {
-        m_renderer.setDrawColor(c.r, c.g, c.b, 255);
-        m_renderer.drawFillRect(rect.x, rect.y, rect.w, rect.h);
-      }
+      drawTileBody(getEmptyTileColor(), getTileRect(x, y));
     }
   }
+  m_renderer.flushSprites();
 }
 
 // Helpers
@@ -1640,10 +1692,103 @@ Color Game::getTextColor(int val) const {
   return (val <= 4) ? Color{119, 110, 101, 255} : Color{249, 246, 242, 255};
 }
 
+void Game::drawTileBody(const Color &c, const SDL_Rect &rect) {
+  if (m_tileTexture) {
+    // Queued; the caller flushes the whole board in one draw
+    m_renderer.batchSprite(*m_tileTexture, rect, c.r, c.g, c.b);
+  } else {
+    m_renderer.setDrawColor(c.r, c.g, c.b, 255);
+    m_renderer.drawFillRect(rect.x, rect.y, rect.w, rect.h);
+  }
+}
+
+SDL_Rect Game::getAnimatedTileRect(const Animation &anim, int shakeX) const {
+  float t = anim.getProgress();
+  float curX = anim.startX + (anim.endX - anim.startX) * t;
+  float curY = anim.startY + (anim.endY - anim.startY) * t;
+
+  // Scaling for Spawn
+  float curScale = anim.startScale + (anim.endScale - anim.startScale) * t;
+
+  SDL_Rect sz = getTileRect(0, 0); // Base size
+  int w = static_cast<int>(sz.w * curScale);
+  int h = static_cast<int>(sz.h * curScale);
+
+  // Center the scaled rect
+  return {(int)curX + (sz.w - w) / 2 + shakeX, // Apply Shake
+          (int)curY + (sz.h - h) / 2, w, h};
+}
+
+void Game::drawTileLabel(int value, const SDL_Rect &rect) {
+  Color tc = getTextColor(value);
+  const Engine::Texture *label =
+      m_tileLabels.get(m_renderer, value, m_font, tc.r, tc.g, tc.b);
+  if (!label) {
+    m_renderer.drawTextCentered(std::to_string(value), m_font,
+                                rect.x + rect.w / 2, rect.y + rect.h / 2, tc.r,
+                                tc.g, tc.b, tc.a);
+    return;
+  }
+  // Unscaled, centered on the tile (spawning tiles grow under it)
+  SDL_Rect dst = {rect.x + (rect.w - label->getWidth()) / 2,
+                  rect.y + (rect.h - label->getHeight()) / 2,
+                  label->getWidth(), label->getHeight()};
+  m_renderer.drawTexture(*label, dst);
+}
+
 void Game::resetGame() {
-  m_grid = Core::Grid();
-  m_grid.spawnRandomTile();
+  m_grid = Core::Grid(); // Plain value, no RNG state to re-seed
+  m_grid.spawnRandomTile(m_rng);
   m_score = 0;
+  clearHint();
+}
+
+void Game::requestHint() {
+  // The packed board holds tiles up to 32768
+  for (int y = 0; y < Core::Grid::SIZE; ++y)
+    for (int x = 0; x < Core::Grid::SIZE; ++x)
+      if (m_grid.getExponent(x, y) > Core::Bitboard::MAX_EXPONENT)
+        return;
+  if (m_hintRequested)
+    return; // Already deepening on this board
+  m_hintWorker.request(Core::Bitboard::fromGrid(m_grid));
+  m_hintRequested = true;
+  m_hint.reset();
+}
+
+void Game::clearHint() {
+  if (m_hintRequested)
+    m_hintWorker.cancel();
+  m_hintRequested = false;
+  m_hint.reset();
+}
+
+void Game::renderHint(int shakeX) {
+  if (!m_hint)
+    return;
+
+  // Accent bar along the grid edge the tiles would slide towards
+  int gridY = 180;
+  int gridSize = 450;
+  int marginX = (WINDOW_WIDTH - gridSize) / 2;
+  int thickness = 8;
+  int gap = 4;
+  SDL_Rect bar = {marginX + shakeX, gridY - gap - thickness, gridSize, thickness};
+  switch (m_hint->move) {
+  case Core::Direction::Up:
+    break;
+  case Core::Direction::Down:
+    bar.y = gridY + gridSize + gap;
+    break;
+  case Core::Direction::Left:
+    bar = {marginX - gap - thickness + shakeX, gridY, thickness, gridSize};
+    break;
+  case Core::Direction::Right:
+    bar = {marginX + gridSize + gap + shakeX, gridY, thickness, gridSize};
+    break;
+  }
+  m_renderer.setDrawColor(237, 194, 46, 255); // 2048 gold
+  m_renderer.drawFillRect(bar.x, bar.y, bar.w, bar.h);
 }
 
 SDL_Rect Game::getTileRect(int x, int y) const {
@@ -1,14 +1,17 @@
 #pragma once
+#include "../ai/HintWorker.hpp"
 #include "../core/GameLogic.hpp"
 #include "../core/Grid.hpp"
 #include "../engine/Context.hpp"
 #include "../engine/Font.hpp"
+#include "../engine/LabelCache.hpp"
 #include "../engine/Renderer.hpp"
 #include "../engine/SoundManager.hpp"
 #include "../engine/Texture.hpp"
 #include "../engine/Window.hpp"
 #include "AnimationManager.hpp" // Added
 #include "InputManager.hpp"     // Added
+#include <optional>
 #include <set>                  // Added
 
 namespace Game {
@@ -56,10 +59,18 @@ private:
   void renderBestScores();
   void renderAchievements();
   void renderAchievementPopup();
+  void renderFrameStats();
+  // True while the picture changes without input (animations, popup, pulse)
+  [[nodiscard]] bool isSceneAnimated() const;
   void renderPlaceholder(const std::string &title);
 
   void resetGame();
 
+  // Hint: analysed on a background thread, picked up in update()
+  void requestHint();
+  void clearHint();
+  void renderHint(int shakeX);
+
   // Scoring
   int m_score;
   int m_bestScore;
@@ -67,15 +78,12 @@ private:
   // Rendering Helpers
   [[nodiscard]] Color getTileColor(int value) const;
   [[nodiscard]] SDL_Rect getTileRect(int x, int y) const;
-
-  // Visual Overhaul
-  std::unique_ptr<Engine::Texture> m_tileTexture;
-  std::unique_ptr<Engine::Texture> m_logoTexture;
-  std::unique_ptr<Engine::Texture> m_buttonTexture;
-  std::unique_ptr<Engine::Texture> m_starTexture;
-  std::vector<std::unique_ptr<Engine::Texture>> m_achievementTextures;
-  std::unique_ptr<Engine::Texture> m_glassTileTexture; // For Menu Grid
-  std::unique_ptr<Engine::Texture> m_iconsTexture;     // For Menu Icons
+  // Tile body tinted `c`; queued in the renderer's sprite batch
+  void drawTileBody(const Color &c, const SDL_Rect &rect);
+  [[nodiscard]] SDL_Rect getAnimatedTileRect(const Animation &anim,
+                                             int shakeX) const;
+  // Tile number centered in `rect`, from m_tileLabels
+  void drawTileLabel(int value, const SDL_Rect &rect);
 
   void renderHeader();
   void renderScoreBox(const std::string &label, int value, int x, int y);
@@ -107,6 +115,18 @@ private:
   Engine::Font m_fontSmall;            // Size 18 (Labels)
   Engine::Font m_fontMedium;           // Size 30 (Score Values)
   Engine::Font m_fontTiny;             // Size 20 (Compact Buttons)
+  Engine::LabelCache m_tileLabels;     // Tile numbers (after the fonts)
+
+  // Visual Overhaul. Declared after m_renderer so they are destroyed before
+  // it (textures report to their renderer's FrameStats)
+  std::unique_ptr<Engine::Texture> m_tileTexture;
+  std::unique_ptr<Engine::Texture> m_logoTexture;
+  std::unique_ptr<Engine::Texture> m_buttonTexture;
+  std::unique_ptr<Engine::Texture> m_starTexture;
+  std::vector<std::unique_ptr<Engine::Texture>> m_achievementTextures;
+  std::unique_ptr<Engine::Texture> m_glassTileTexture; // For Menu Grid
+  std::unique_ptr<Engine::Texture> m_iconsTexture;     // For Menu Icons
+
   InputManager m_inputManager;         // Added
   AnimationManager m_animationManager; // Added
   Engine::SoundManager m_soundManager;
@@ -116,9 +136,14 @@ private:
   // Core Components
   Core::Grid m_grid;
   Core::GameLogic m_logic;
+  Core::Rng m_rng; // Tile spawns (seeded once from entropy)
+  AI::HintWorker m_hintWorker;
+  bool m_hintRequested; // For the current board
+  std::optional<AI::HintWorker::Hint> m_hint; // Deepest result so far
 
   // State
   bool m_isRunning;
+  bool m_sceneDirty = true; // Something on screen changed since last render
   GameState m_state;
   GameState m_previousState; // Added for navigation
   int m_menuSelection;       // Reused for all menus
@@ -126,6 +151,7 @@ private:
   // Settings
   bool m_darkSkin; // True = Dark Mode
   bool m_soundOn;  // True = Sound Enabled
+  bool m_showFrameStats = false; // F3 debug overlay
 
   // Constants
   static constexpr int WINDOW_WIDTH = 600;
@@ -134,6 +160,7 @@ private:
   static constexpr int GRID_PADDING = 20;
   static constexpr int GRID_OFFSET_X = 50;
   static constexpr int GRID_OFFSET_Y = 50;
+  static constexpr int IDLE_WAIT_MS = 500; // Longest sleep of an idle loop
 
   // Achievements State
   std::vector<bool> m_unlockedAchievements;
@@ -2,11 +2,30 @@
 
 namespace Game {
 
+InputManager::InputManager() : m_wakeEvent(SDL_RegisterEvents(1)) {}
+
+void InputManager::waitForEvent(int timeoutMs) {
+  SDL_WaitEventTimeout(nullptr, timeoutMs);
+}
+
+void InputManager::wake() const {
+  if (m_wakeEvent == static_cast<Uint32>(-1))
+    return; // No user event left; callers fall back to the wait timeout
+  SDL_Event e{};
+  e.type = m_wakeEvent;
+  SDL_PushEvent(&e);
+}
+
 Action InputManager::pollAction(int &mouseX, int &mouseY, bool &mouseClicked) {
   SDL_Event e;
   mouseClicked = false; // Reset per frame/poll loop start
+  m_sawSceneEvent = false;
 
   while (SDL_PollEvent(&e)) {
+    if (e.type != SDL_MOUSEMOTION && e.type != SDL_KEYUP &&
+        e.type != SDL_MOUSEBUTTONUP)
+      m_sawSceneEvent = true;
+
     if (e.type == SDL_QUIT) {
       return Action::Quit;
     } else if (e.type == SDL_KEYDOWN) {
@@ -50,6 +69,10 @@ Action InputManager::translateKey(SDL_Keycode key) {
     return Action::Back;
   case SDLK_r:
     return Action::Restart;
+  case SDLK_h:
+    return Action::Hint;
+  case SDLK_F3:
+    return Action::ToggleStats;
   case SDLK_RETURN:
   case SDLK_SPACE:         // Add SPACE as well
     return Action::Select; // Was Confirm
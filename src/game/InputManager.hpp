@@ -13,12 +13,14 @@ enum class Action {
   Restart,
   Confirm,
   Back,
-  Select
+  Select,
+  Hint,
+  ToggleStats // Frame statistics overlay
 };
 
 class InputManager {
 public:
-  InputManager() = default;
+  InputManager(); // Registers the wake-up event; SDL must be initialized
   ~InputManager() = default;
 
   // Polls for events and translates them into High-Level Actions.
@@ -28,8 +30,22 @@ public:
   // Also captures mouse state.
   Action pollAction(int &mouseX, int &mouseY, bool &mouseClicked);
 
+  // True if the last pollAction() dequeued an event that can change what is
+  // on screen (anything but mouse motion and key/button releases).
+  [[nodiscard]] bool sawSceneEvent() const { return m_sawSceneEvent; }
+
+  // Blocks until an event is queued or `timeoutMs` passes. The event stays
+  // queued for the next pollAction().
+  void waitForEvent(int timeoutMs);
+
+  // Queues a wake-up event. Safe to call from any thread.
+  void wake() const;
+
 private:
   Action translateKey(SDL_Keycode key);
+
+  Uint32 m_wakeEvent;
+  bool m_sawSceneEvent = false;
 };
 
 } // namespace Game
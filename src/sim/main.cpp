@@ -0,0 +1,223 @@
+#include "Simulator.hpp"
+#include "Strategy.hpp"
+#include "TranspositionTable.hpp"
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Headless simulation runner: plays games with a strategy over a seed range
+// and prints throughput, score distribution and max-tile frequencies.
+// Links only the Core/AI libraries (no SDL, no display, no audio).
+
+namespace {
+
+struct Options {
+  std::string strategy = "greedy";
+  std::uint64_t games = 10000;
+  std::uint64_t seed = 1;
+  unsigned threads = 0; // 0 = all hardware threads
+  bool parallelSearch = false;
+  std::size_t tableMb = 0; // Transposition table size, 0 = none
+  bool hugePages = false;
+  double moveMs = 0.0; // Per-move budget of anytime strategies, 0 = default
+};
+
+void printUsage(const char *program) {
+  std::printf("Usage: %s [--strategy NAME] [--games N] [--seed FIRST] "
+              "[--threads N] [--parallel-search] [--table-mb N] "
+              "[--huge-pages] [--move-ms MS]\n\n"
+              "  --strategy NAME  Move policy (default: greedy)\n"
+              "  --games N        Number of games to play (default: 10000)\n"
+              "  --seed FIRST     Game i uses seed FIRST + i (default: 1)\n"
+              "  --threads N      Worker threads, 0 = all cores (default: 0)\n"
+              "                   Results do not depend on the thread count.\n"
+              "  --parallel-search  Play games one at a time and spread each\n"
+              "                   search over the threads instead\n"
+              "  --table-mb N     Transposition table shared by all searches\n"
+              "                   (default: 0 = none). Cached values depend\n"
+              "                   on thread timing, so runs may differ.\n"
+              "  --huge-pages     Back the table with huge pages if possible\n"
+              "  --move-ms MS     Time per move for anytime strategies (mcts,\n"
+              "                   default: 10); their results vary with load\n\n"
+              "Strategies:",
+              program);
+  for (const auto &name : AI::strategyNames())
+    std::printf(" %s", name.c_str());
+  std::printf("\n");
+}
+
+// Parses a whole non-negative number: no sign, no spaces, nothing after it
+template <typename T> bool parseValue(const std::string &text, T &out) {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (text.empty() || !(std::isdigit(static_cast<unsigned char>(text[0])) ||
+                          text[0] == '.'))
+      return false;
+    char *end = nullptr;
+    errno = 0;
+    const double value = std::strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size() || errno != 0)
+      return false;
+    out = static_cast<T>(value);
+    return true;
+  } else {
+    const char *end = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+    return ec == std::errc() && ptr == end;
+  }
+}
+
+enum class ParseResult { Run, Help, Error };
+
+ParseResult parseOptions(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      printUsage(argv[0]);
+      return ParseResult::Help;
+    }
+    if (arg == "--parallel-search") {
+      options.parallelSearch = true;
+      continue;
+    }
+    if (arg == "--huge-pages") {
+      options.hugePages = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+    const std::string value = argv[++i];
+    bool valid = true;
+    if (arg == "--strategy") {
+      options.strategy = value;
+    } else if (arg == "--games") {
+      valid = parseValue(value, options.games);
+    } else if (arg == "--seed") {
+      valid = parseValue(value, options.seed);
+    } else if (arg == "--move-ms") {
+      valid = parseValue(value, options.moveMs);
+    } else if (arg == "--table-mb") {
+      valid = parseValue(value, options.tableMb);
+    } else if (arg == "--threads") {
+      valid = parseValue(value, options.threads);
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+    if (!valid) {
+      std::fprintf(stderr, "Invalid value for %s: %s\n", arg.c_str(),
+                   value.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+  }
+  return ParseResult::Run;
+}
+
+void printReport(const Options &options, unsigned threads,
+                 const AI::SimulationStats &stats) {
+  std::printf("Strategy %s, %llu games, seeds [%llu, %llu), %u threads\n",
+              options.strategy.c_str(),
+              static_cast<unsigned long long>(stats.games),
+              static_cast<unsigned long long>(options.seed),
+              static_cast<unsigned long long>(options.seed + options.games),
+              threads);
+  std::printf("Time      %.3f s  (%.1f games/s, %.0f moves/s)\n",
+              stats.seconds, stats.gamesPerSecond(), stats.movesPerSecond());
+  const std::vector<int> sorted = stats.sortedScores();
+  const auto percentile = [&sorted](double p) {
+    return AI::SimulationStats::scorePercentile(sorted, p);
+  };
+  std::printf("Score     mean %.1f  min %d  p10 %d  p50 %d  p90 %d  p99 %d  "
+              "max %d\n",
+              stats.meanScore(), percentile(0), percentile(10),
+              percentile(50), percentile(90), percentile(99),
+              percentile(100));
+
+  if (stats.search.searches > 0) {
+    // Search time is summed over threads, so nodes/s is per thread
+    std::printf("Search    %.2fM nodes/s per thread  %.3f ms/move  "
+                "%.0f nodes/move\n",
+                stats.search.nodesPerSecond() / 1e6,
+                stats.search.averageSearchMs(),
+                static_cast<double>(stats.search.nodes) /
+                    static_cast<double>(stats.search.searches));
+  }
+
+  std::printf("Max tile  %8s  %12s  %7s  %7s\n", "tile", "games", "share",
+              "reached");
+  // "reached" = share of games whose max tile is at least this one
+  std::uint64_t atLeast = stats.games;
+  for (int e = 0; e <= AI::SimulationStats::MAX_EXPONENT; ++e) {
+    const std::uint64_t count = stats.maxTileCounts[e];
+    if (count != 0) {
+      std::printf("          %8d  %12llu  %6.2f%%  %6.2f%%\n", 1 << e,
+                  static_cast<unsigned long long>(count),
+                  100.0 * count / stats.games, 100.0 * atLeast / stats.games);
+    }
+    atLeast -= count;
+  }
+}
+
+void printTableReport(const AI::TranspositionTable &table) {
+  const auto t = table.stats();
+  const std::uint64_t probes = t.hits + t.misses;
+  std::printf("Table     %zu MB%s  hits %.1f%% of %llu probes  "
+              "collisions %llu\n",
+              table.sizeBytes() >> 20,
+              table.usesHugePages() ? " (huge pages)" : "",
+              probes ? 100.0 * t.hits / probes : 0.0,
+              static_cast<unsigned long long>(probes),
+              static_cast<unsigned long long>(t.collisions));
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  try {
+    const ParseResult parsed = parseOptions(argc, argv, options);
+    if (parsed != ParseResult::Run)
+      return parsed == ParseResult::Help ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    AI::makeStrategy(options.strategy); // Reject unknown names up front
+    AI::ThreadPool pool(options.threads);
+    std::unique_ptr<AI::TranspositionTable> table;
+    if (options.tableMb > 0) {
+      table = std::make_unique<AI::TranspositionTable>(
+          (options.tableMb << 20) / 16, options.hugePages);
+    }
+
+    AI::SimulationStats stats;
+    if (options.parallelSearch) {
+      auto strategy = AI::makeStrategy(options.strategy, &pool, table.get(),
+                                       options.moveMs);
+      stats = AI::Simulator(*strategy).run(options.seed, options.games);
+    } else {
+      stats = AI::Simulator::runParallel(
+          pool,
+          [&options, &table] {
+            return AI::makeStrategy(options.strategy, nullptr, table.get(),
+                                    options.moveMs);
+          },
+          options.seed, options.games);
+    }
+    printReport(options, pool.size(), stats);
+    if (table)
+      printTableReport(*table);
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "Error: %s\n", e.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
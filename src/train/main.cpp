@@ -0,0 +1,264 @@
+#include "NTuple.hpp"
+#include "QuantizedNTuple.hpp"
+#include "Simulator.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// N-tuple trainer: learns afterstate values by TD(0) self-play on all cores,
+// saves them as a mappable weights file and measures the greedy player that
+// uses them. Links only the Core/AI libraries.
+
+namespace {
+
+constexpr int EXPONENT_2048 = 11;
+
+struct Options {
+  std::uint64_t games = 100000;
+  std::uint64_t seed = 1;
+  unsigned threads = 0; // 0 = all hardware threads
+  float alpha = 0.1f;
+  std::string tuples = "standard";
+  std::string input;  // Weights to continue from (empty = start at zero)
+  std::string output = "ntuple.bin";
+  std::uint64_t report = 10000;
+  std::uint64_t evalGames = 1000;
+  std::string quantize; // Evaluate with int16/int8 weights (empty = float)
+};
+
+void printUsage(const char *program) {
+  std::printf("Usage: %s [--games N] [--seed FIRST] [--threads N] "
+              "[--alpha A] [--tuples standard|small] [--in FILE] "
+              "[--out FILE] [--report N] [--eval-games N] "
+              "[--quantize int16|int8]\n\n"
+              "  --games N        Self-play training games, 0 = only evaluate\n"
+              "                   --in (default: 100000)\n"
+              "  --seed FIRST     Game i uses seed FIRST + i (default: 1)\n"
+              "  --threads N      Worker threads, 0 = all cores (default: 0)\n"
+              "  --alpha A        Learning rate, shared by all features\n"
+              "                   (default: 0.1)\n"
+              "  --tuples SET     standard (4 x 6 cells, 256 MB) or small\n"
+              "                   (4 x 4 cells, 1 MB); ignored with --in\n"
+              "  --in FILE        Continue from a weights file\n"
+              "  --out FILE       Weights file, rewritten after every report\n"
+              "                   (default: ntuple.bin)\n"
+              "  --report N       Progress line every N games (default: 10000)\n"
+              "  --eval-games N   Games played by the trained greedy player\n"
+              "                   afterwards (default: 1000)\n"
+              "  --quantize BITS  Evaluate with int16 or int8 weights\n",
+              program);
+}
+
+// Parses a whole non-negative number: no sign, no spaces, nothing after it
+template <typename T> bool parseValue(const std::string &text, T &out) {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (text.empty() || !(std::isdigit(static_cast<unsigned char>(text[0])) ||
+                          text[0] == '.'))
+      return false;
+    char *end = nullptr;
+    errno = 0;
+    const double value = std::strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size() || errno != 0)
+      return false;
+    out = static_cast<T>(value);
+    return true;
+  } else {
+    const char *end = text.data() + text.size();
+    const auto [ptr, ec] = std::from_chars(text.data(), end, out);
+    return ec == std::errc() && ptr == end;
+  }
+}
+
+enum class ParseResult { Run, Help, Error };
+
+ParseResult parseOptions(int argc, char *argv[], Options &options) {
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      printUsage(argv[0]);
+      return ParseResult::Help;
+    }
+    if (i + 1 >= argc) {
+      std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+    const std::string value = argv[++i];
+    bool valid = true;
+    if (arg == "--games") {
+      valid = parseValue(value, options.games);
+    } else if (arg == "--seed") {
+      valid = parseValue(value, options.seed);
+    } else if (arg == "--threads") {
+      valid = parseValue(value, options.threads);
+    } else if (arg == "--alpha") {
+      valid = parseValue(value, options.alpha);
+    } else if (arg == "--tuples") {
+      options.tuples = value;
+    } else if (arg == "--in") {
+      options.input = value;
+    } else if (arg == "--out") {
+      options.output = value;
+    } else if (arg == "--report") {
+      valid = parseValue(value, options.report);
+      options.report = std::max<std::uint64_t>(1, options.report);
+    } else if (arg == "--quantize") {
+      if (value != "int16" && value != "int8") {
+        std::fprintf(stderr,
+                     "Invalid value for --quantize: %s (expected int16 or "
+                     "int8)\n",
+                     value.c_str());
+        printUsage(argv[0]);
+        return ParseResult::Error;
+      }
+      options.quantize = value;
+    } else if (arg == "--eval-games") {
+      valid = parseValue(value, options.evalGames);
+    } else {
+      std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+    if (!valid) {
+      std::fprintf(stderr, "Invalid value for %s: %s\n", arg.c_str(),
+                   value.c_str());
+      printUsage(argv[0]);
+      return ParseResult::Error;
+    }
+  }
+  return ParseResult::Run;
+}
+
+std::unique_ptr<AI::NTupleNetwork> makeNetwork(const Options &options) {
+  if (!options.input.empty())
+    return AI::NTupleNetwork::load(options.input);
+  if (options.tuples == "standard")
+    return std::make_unique<AI::NTupleNetwork>(
+        AI::NTupleNetwork::standardTuples());
+  if (options.tuples == "small")
+    return std::make_unique<AI::NTupleNetwork>(AI::NTupleNetwork::smallTuples());
+  throw std::invalid_argument("Unknown tuple set: " + options.tuples);
+}
+
+// Per-worker progress; alignas keeps two workers off the same cache line
+struct alignas(64) WorkerTally {
+  std::uint64_t games = 0;
+  std::uint64_t score = 0;
+  std::uint64_t reached2048 = 0;
+};
+
+void train(const Options &options, AI::ThreadPool &pool,
+           AI::NTupleNetwork &network) {
+  std::vector<WorkerTally> tallies(pool.size());
+  const auto start = std::chrono::steady_clock::now();
+
+  for (std::uint64_t done = 0; done < options.games;) {
+    const std::uint64_t batch = std::min(options.report, options.games - done);
+    std::fill(tallies.begin(), tallies.end(), WorkerTally{});
+    pool.parallelFor(batch, 16,
+                     [&](std::uint64_t begin, std::uint64_t end, unsigned worker) {
+                       WorkerTally &tally = tallies[worker];
+                       for (std::uint64_t i = begin; i < end; ++i) {
+                         const AI::GameRecord game = AI::playTrainingGame(
+                             network, options.alpha, options.seed + done + i);
+                         ++tally.games;
+                         tally.score += static_cast<std::uint64_t>(game.score);
+                         tally.reached2048 += game.maxExponent >= EXPONENT_2048;
+                       }
+                     });
+    done += batch;
+
+    WorkerTally sum;
+    for (const WorkerTally &tally : tallies) {
+      sum.games += tally.games;
+      sum.score += tally.score;
+      sum.reached2048 += tally.reached2048;
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    std::printf("games %10llu  mean %9.1f  2048 %6.2f%%  %8.1f games/s\n",
+                static_cast<unsigned long long>(done),
+                static_cast<double>(sum.score) / static_cast<double>(sum.games),
+                100.0 * static_cast<double>(sum.reached2048) /
+                    static_cast<double>(sum.games),
+                static_cast<double>(done) / seconds);
+    std::fflush(stdout);
+    network.save(options.output);
+  }
+}
+
+void evaluate(const Options &options, AI::ThreadPool &pool,
+              const AI::NTupleNetwork &network) {
+  // Seeds after the training range, so no evaluation game was trained on
+  const std::uint64_t firstSeed = options.seed + options.games;
+  std::unique_ptr<AI::QuantizedNTupleNetwork> quantized;
+  if (!options.quantize.empty()) {
+    quantized = std::make_unique<AI::QuantizedNTupleNetwork>(
+        network, options.quantize == "int16" ? AI::WeightPrecision::Int16
+                                             : AI::WeightPrecision::Int8);
+  }
+
+  const AI::SimulationStats stats = AI::Simulator::runParallel(
+      pool,
+      [&network, &quantized]() -> std::unique_ptr<AI::Strategy> {
+        if (quantized)
+          return std::make_unique<AI::NTupleStrategy>(*quantized);
+        return std::make_unique<AI::NTupleStrategy>(network);
+      },
+      firstSeed, options.evalGames);
+
+  const std::vector<int> sorted = stats.sortedScores();
+  std::printf("Evaluation %llu games  mean %.1f  p50 %d  max %d  "
+              "(%.1f games/s)\n",
+              static_cast<unsigned long long>(stats.games), stats.meanScore(),
+              AI::SimulationStats::scorePercentile(sorted, 50),
+              AI::SimulationStats::scorePercentile(sorted, 100),
+              stats.gamesPerSecond());
+  std::uint64_t atLeast = stats.games;
+  for (int e = 0; e <= AI::SimulationStats::MAX_EXPONENT; ++e) {
+    if (e >= EXPONENT_2048 && atLeast > 0)
+      std::printf("  reached %6d  %6.2f%%\n", 1 << e,
+                  100.0 * static_cast<double>(atLeast) / stats.games);
+    atLeast -= stats.maxTileCounts[e];
+  }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  Options options;
+  try {
+    const ParseResult parsed = parseOptions(argc, argv, options);
+    if (parsed != ParseResult::Run)
+      return parsed == ParseResult::Help ? EXIT_SUCCESS : EXIT_FAILURE;
+
+    auto network = makeNetwork(options);
+    AI::ThreadPool pool(options.threads);
+    std::printf("N-tuple network: %zu tuples, %.1f MB of weights%s, %u threads\n",
+                network->tuples().size(),
+                static_cast<double>(network->weightCount() * sizeof(float)) /
+                    (1 << 20),
+                network->isMapped() ? " (mapped)" : "", pool.size());
+
+    if (options.games > 0)
+      train(options, pool, *network);
+    if (options.evalGames > 0)
+      evaluate(options, pool, *network);
+  } catch (const std::exception &e) {
+    std::fprintf(stderr, "Error: %s\n", e.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Heap allocation counting for "does not allocate" tests. AllocCounter.cpp
+// replaces the global operator new of the whole test binary; the
+// replacement only counts and forwards to malloc.
+
+// Allocations through operator new since the binary started
+long allocationCount();
+
+// Counts heap allocations performed while running fn
+template <typename Fn> long countAllocations(Fn fn) {
+  const long before = allocationCount();
+  fn();
+  return allocationCount() - before;
+}
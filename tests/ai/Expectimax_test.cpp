@@ -0,0 +1,107 @@
+#include "Expectimax.hpp"
+#include "Simulator.hpp"
+#include "ThreadPool.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace {
+
+Core::Bitboard boardFromRows(std::initializer_list<std::initializer_list<int>> rows) {
+  Core::Bitboard board;
+  int y = 0;
+  for (const auto &row : rows) {
+    int x = 0;
+    for (int e : row)
+      board.setExponent(x++, y, e);
+    ++y;
+  }
+  return board;
+}
+
+} // namespace
+
+TEST(ExpectimaxTest, DepthGrowsAsTheBoardFills) {
+  AI::ExpectimaxStrategy search;
+  EXPECT_LE(search.depthFor(12), search.depthFor(6));
+  EXPECT_LE(search.depthFor(6), search.depthFor(2));
+
+  AI::ExpectimaxStrategy::Config shallow;
+  shallow.maxDepth = 2;
+  EXPECT_EQ(AI::ExpectimaxStrategy(shallow).depthFor(0), 2);
+}
+
+TEST(ExpectimaxTest, DepthOutsideTableRangeThrows) {
+  AI::ExpectimaxStrategy::Config config;
+  config.maxDepth = 0;
+  EXPECT_THROW(AI::ExpectimaxStrategy{config}, std::invalid_argument);
+  config.maxDepth = AI::ExpectimaxStrategy::MAX_DEPTH + 1;
+  EXPECT_THROW(AI::ExpectimaxStrategy{config}, std::invalid_argument);
+
+  AI::ExpectimaxStrategy search;
+  const Core::Bitboard board(0x0000'0000'0000'0011ULL);
+  EXPECT_THROW(search.search(board, 0), std::invalid_argument);
+  EXPECT_THROW(search.search(board, AI::ExpectimaxStrategy::MAX_DEPTH + 1),
+               std::invalid_argument);
+}
+
+TEST(ExpectimaxTest, OnlyLegalMoveIsChosen) {
+  // Full board where only the bottom row can merge horizontally
+  const auto board = boardFromRows({{1, 2, 1, 2},
+                                    {2, 1, 2, 1},
+                                    {1, 2, 1, 2},
+                                    {3, 3, 4, 5}});
+  AI::ExpectimaxStrategy search;
+  const auto result = search.search(board);
+
+  ASSERT_TRUE(result.found);
+  EXPECT_TRUE(result.move == Core::Direction::Left ||
+              result.move == Core::Direction::Right);
+}
+
+TEST(ExpectimaxTest, ParallelSearchMatchesSequential) {
+  const auto board = boardFromRows({{1, 0, 2, 3},
+                                    {0, 4, 1, 0},
+                                    {2, 0, 0, 5},
+                                    {1, 6, 0, 7}});
+  AI::ExpectimaxStrategy sequential;
+  const auto expected = sequential.search(board);
+
+  AI::ThreadPool pool(3);
+  AI::ExpectimaxStrategy::Config config;
+  config.pool = &pool;
+  AI::ExpectimaxStrategy parallel(config);
+  const auto result = parallel.search(board);
+
+  EXPECT_EQ(result.move, expected.move);
+  EXPECT_DOUBLE_EQ(result.value, expected.value);
+  EXPECT_EQ(result.nodes, expected.nodes);
+}
+
+TEST(ExpectimaxTest, ProbabilityCutoffPrunesNodes) {
+  const auto board = boardFromRows({{1, 2, 3, 4},
+                                    {0, 0, 2, 1},
+                                    {0, 1, 0, 0},
+                                    {2, 0, 0, 1}});
+  AI::ExpectimaxStrategy::Config loose;
+  loose.probabilityCutoff = 0.0;
+  AI::ExpectimaxStrategy::Config tight;
+  tight.probabilityCutoff = 0.05; // Drops the 4-spawn branches below the root
+
+  EXPECT_LT(AI::ExpectimaxStrategy(tight).search(board).nodes,
+            AI::ExpectimaxStrategy(loose).search(board).nodes);
+}
+
+TEST(ExpectimaxTest, BeatsGreedyAndReportsSearchStats) {
+  AI::ExpectimaxStrategy::Config config;
+  config.maxDepth = 2; // Keep the test fast
+  AI::ExpectimaxStrategy expectimax(config);
+  AI::GreedyStrategy greedy;
+
+  const auto smart = AI::Simulator(expectimax).run(1, 3);
+  const auto baseline = AI::Simulator(greedy).run(1, 3);
+
+  EXPECT_GT(smart.meanScore(), baseline.meanScore());
+  EXPECT_EQ(smart.search.searches, smart.moves);
+  EXPECT_GT(smart.search.nodes, smart.search.searches);
+  EXPECT_EQ(baseline.search.searches, 0u);
+}
@@ -0,0 +1,140 @@
+#include "HintWorker.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+Core::Bitboard boardFromRows(std::initializer_list<std::initializer_list<int>> rows) {
+  Core::Bitboard board;
+  int y = 0;
+  for (const auto &row : rows) {
+    int x = 0;
+    for (int e : row)
+      board.setExponent(x++, y, e);
+    ++y;
+  }
+  return board;
+}
+
+const Core::Bitboard MIDGAME = boardFromRows({{1, 0, 2, 3},
+                                              {0, 4, 1, 0},
+                                              {2, 0, 0, 5},
+                                              {1, 6, 0, 7}});
+
+// Polls until a hint of at least `depth` arrives or 10 s pass
+std::optional<AI::HintWorker::Hint> waitForDepth(const AI::HintWorker &worker,
+                                                 int depth) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (std::chrono::steady_clock::now() < deadline) {
+    const auto hint = worker.poll();
+    if (hint && hint->depth >= depth)
+      return hint;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+TEST(HintWorkerTest, DeepensToMaxDepthAndMatchesSearch) {
+  AI::HintWorker::Config config;
+  config.maxDepth = 3;
+  config.tableEntries = 0; // Same values as a fresh search
+  AI::HintWorker worker(config);
+  EXPECT_FALSE(worker.poll().has_value());
+
+  worker.request(MIDGAME);
+  const auto hint = waitForDepth(worker, 3);
+  ASSERT_TRUE(hint.has_value());
+  EXPECT_EQ(hint->depth, 3);
+
+  AI::ExpectimaxStrategy search;
+  EXPECT_EQ(hint->move, search.search(MIDGAME, 3).move);
+}
+
+TEST(HintWorkerTest, NotifiesEveryPublishedDepth) {
+  std::atomic<int> notifications{0};
+  AI::HintWorker::Config config;
+  config.maxDepth = 3;
+  config.onResult = [&notifications] { ++notifications; };
+  AI::HintWorker worker(config);
+
+  worker.request(MIDGAME);
+  ASSERT_TRUE(waitForDepth(worker, 3).has_value());
+  // The callback runs right after the store poll() just observed
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (notifications.load() < 3 && std::chrono::steady_clock::now() < deadline)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_EQ(notifications.load(), 3);
+}
+
+TEST(HintWorkerTest, NewRequestReplacesOldOne) {
+  AI::HintWorker worker;
+  worker.request(MIDGAME);
+  // Only Left/Right merge the bottom row
+  const auto stuck = boardFromRows({{1, 2, 1, 2},
+                                    {2, 1, 2, 1},
+                                    {1, 2, 1, 2},
+                                    {3, 3, 4, 5}});
+  worker.request(stuck);
+  const auto hint = waitForDepth(worker, 2);
+  ASSERT_TRUE(hint.has_value());
+  EXPECT_TRUE(hint->move == Core::Direction::Left ||
+              hint->move == Core::Direction::Right);
+}
+
+TEST(HintWorkerTest, CancelClearsTheHint) {
+  AI::HintWorker worker;
+  worker.request(MIDGAME);
+  ASSERT_TRUE(waitForDepth(worker, 1).has_value());
+  worker.cancel();
+  EXPECT_FALSE(worker.poll().has_value());
+}
+
+TEST(HintWorkerTest, LostBoardGivesNoHint) {
+  AI::HintWorker worker;
+  worker.request(boardFromRows(
+      {{1, 2, 1, 2}, {2, 1, 2, 1}, {1, 2, 1, 2}, {2, 1, 2, 1}}));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(worker.poll().has_value());
+}
+
+TEST(HintWorkerTest, DestructionAbandonsDeepSearch) {
+  const auto start = std::chrono::steady_clock::now();
+  {
+    AI::HintWorker::Config config;
+    config.maxDepth = 15; // Would take far longer than the test budget
+    AI::HintWorker worker(config);
+    worker.request(MIDGAME);
+    ASSERT_TRUE(waitForDepth(worker, 2).has_value());
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(HintWorkerTest, BackToBackRequestsNeverStrandTheLatest) {
+  // A lost stop would leave the worker in a full depth-15 search of a stale
+  // request, far beyond the time allowed for the latest one
+  AI::HintWorker::Config config;
+  config.maxDepth = 15;
+  AI::HintWorker worker(config);
+  for (int i = 0; i < 50; ++i) {
+    worker.request(MIDGAME);
+    worker.cancel();
+    worker.request(MIDGAME);
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(waitForDepth(worker, 1).has_value()) << "iteration " << i;
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2))
+        << "iteration " << i;
+  }
+}
+
+TEST(HintWorkerTest, InvalidDepthThrows) {
+  AI::HintWorker::Config config;
+  config.maxDepth = 0;
+  EXPECT_THROW(AI::HintWorker{config}, std::invalid_argument);
+  config.maxDepth = 16;
+  EXPECT_THROW(AI::HintWorker{config}, std::invalid_argument);
+}
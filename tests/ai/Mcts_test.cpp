@@ -0,0 +1,162 @@
+#include "../AllocCounter.hpp"
+#include "Mcts.hpp"
+#include "NodeArena.hpp"
+#include "Simulator.hpp"
+#include "ThreadPool.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace {
+
+Core::Bitboard boardFromRows(std::initializer_list<std::initializer_list<int>> rows) {
+  Core::Bitboard board;
+  int y = 0;
+  for (const auto &row : rows) {
+    int x = 0;
+    for (int e : row)
+      board.setExponent(x++, y, e);
+    ++y;
+  }
+  return board;
+}
+
+AI::MctsStrategy::Config iterationsOnly(std::uint64_t iterations) {
+  AI::MctsStrategy::Config config;
+  config.budgetMs = 0.0;
+  config.iterations = iterations;
+  return config;
+}
+
+} // namespace
+
+TEST(NodeArenaTest, AllocatesRunsUntilFullAndResets) {
+  AI::NodeArena<int> arena(8);
+  EXPECT_EQ(arena.allocate(3), 0u);
+  arena[1] = 42;
+  EXPECT_EQ(arena.allocate(5), 3u);
+  EXPECT_EQ(arena.allocate(1), AI::NodeArena<int>::NONE);
+  EXPECT_EQ(arena.size(), 8u);
+
+  arena.reset();
+  EXPECT_EQ(arena.allocate(2), 0u);
+  EXPECT_EQ(arena[1], 0); // Reallocated nodes are value-initialized
+  EXPECT_EQ(arena.capacity(), 8u);
+}
+
+TEST(MctsTest, NeedsABudgetOrIterationLimit) {
+  AI::MctsStrategy::Config config;
+  config.budgetMs = 0.0;
+  EXPECT_THROW(AI::MctsStrategy{config}, std::invalid_argument);
+}
+
+TEST(MctsTest, OnlyLegalMoveIsChosen) {
+  const auto board = boardFromRows({{1, 2, 1, 2},
+                                    {2, 1, 2, 1},
+                                    {1, 2, 1, 2},
+                                    {3, 3, 4, 5}});
+  AI::MctsStrategy mcts(iterationsOnly(200));
+  Core::Rng rng(1);
+  const auto result = mcts.search(board, rng);
+
+  ASSERT_TRUE(result.found);
+  EXPECT_TRUE(result.move == Core::Direction::Left ||
+              result.move == Core::Direction::Right);
+  EXPECT_GE(result.visits, 100u); // Most visited of the two legal moves
+}
+
+TEST(MctsTest, IterationLimitIsReproducible) {
+  const auto board = boardFromRows({{1, 0, 2, 3},
+                                    {0, 4, 1, 0},
+                                    {2, 0, 0, 5},
+                                    {1, 6, 0, 7}});
+  AI::MctsStrategy a(iterationsOnly(500));
+  AI::MctsStrategy b(iterationsOnly(500));
+  Core::Rng rngA(9);
+  Core::Rng rngB(9);
+  const auto first = a.search(board, rngA);
+  const auto second = b.search(board, rngB);
+
+  EXPECT_EQ(first.move, second.move);
+  EXPECT_EQ(first.visits, second.visits);
+  EXPECT_DOUBLE_EQ(first.value, second.value);
+  EXPECT_EQ(first.nodes, second.nodes);
+}
+
+TEST(MctsTest, RootParallelTreesAddUp) {
+  const auto board = boardFromRows({{1, 2, 3, 4},
+                                    {0, 0, 2, 1},
+                                    {0, 1, 0, 0},
+                                    {2, 0, 0, 1}});
+  AI::ThreadPool pool(3);
+  auto config = iterationsOnly(300);
+  config.pool = &pool;
+  AI::MctsStrategy mcts(config);
+  Core::Rng rng(4);
+  const auto result = mcts.search(board, rng);
+
+  ASSERT_TRUE(result.found);
+  EXPECT_GT(result.visits, 300u / 4); // Best move over three trees
+  EXPECT_LE(result.visits, 3u * 300u);
+}
+
+TEST(MctsTest, FullArenaKeepsSearching) {
+  const auto board = boardFromRows({{1, 2, 3, 4},
+                                    {0, 0, 2, 1},
+                                    {0, 1, 0, 0},
+                                    {2, 0, 0, 1}});
+  auto config = iterationsOnly(400);
+  config.arenaNodes = 16; // Root, its moves and one spawn layer at most
+  AI::MctsStrategy mcts(config);
+  Core::Rng rng(2);
+  const auto result = mcts.search(board, rng);
+
+  ASSERT_TRUE(result.found);
+  EXPECT_GT(result.visits, 0u);
+  EXPECT_GT(result.nodes, 400u); // Rollouts still ran
+}
+
+TEST(MctsTest, TimeBudgetStopsTheSearch) {
+  AI::MctsStrategy::Config config;
+  config.budgetMs = 5.0;
+  AI::MctsStrategy mcts(config);
+  Core::Rng rng(3);
+  mcts.search(boardFromRows({{1, 0, 0, 0}, {0, 0, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 0}}),
+              rng);
+
+  const auto stats = mcts.searchStats();
+  EXPECT_EQ(stats.searches, 1u);
+  EXPECT_LT(stats.seconds, 0.5);
+  EXPECT_GT(stats.nodes, 0u);
+}
+
+TEST(MctsTest, BeatsRandomPlay) {
+  AI::MctsStrategy mcts(iterationsOnly(100));
+  AI::RandomStrategy random;
+
+  const auto smart = AI::Simulator(mcts).run(1, 2);
+  const auto baseline = AI::Simulator(random).run(1, 2);
+
+  EXPECT_GT(smart.meanScore(), baseline.meanScore());
+  EXPECT_EQ(smart.search.searches, smart.moves);
+}
+
+TEST(MctsTest, SearchWithoutPoolDoesNotAllocate) {
+  AI::MctsStrategy::Config config;
+  config.budgetMs = 0.0;
+  config.iterations = 2000; // Enough to fill paths, expand and roll out
+  AI::MctsStrategy mcts(config);
+  const auto board = boardFromRows({{1, 1, 2, 3},
+                                    {0, 2, 2, 0},
+                                    {3, 0, 3, 4},
+                                    {5, 0, 5, 1}});
+  Core::Rng rng(7);
+  mcts.search(board, rng); // Warm up
+
+  for (int move = 0; move < 4; ++move) {
+    long n = countAllocations([&] {
+      const auto result = mcts.search(board, rng);
+      EXPECT_TRUE(result.found);
+    });
+    EXPECT_EQ(n, 0) << "search " << move;
+  }
+}
@@ -0,0 +1,120 @@
+#include "NTuple.hpp"
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+Core::Bitboard boardFromRows(std::initializer_list<std::initializer_list<int>> rows) {
+  Core::Bitboard board;
+  int y = 0;
+  for (const auto &row : rows) {
+    int x = 0;
+    for (int e : row)
+      board.setExponent(x++, y, e);
+    ++y;
+  }
+  return board;
+}
+
+std::string tempPath(const char *name) {
+  return ::testing::TempDir() + name;
+}
+
+} // namespace
+
+TEST(NTupleTest, SymmetriesAreTheEightDihedralImages) {
+  const auto board = boardFromRows({{1, 2, 0, 0},
+                                    {0, 0, 0, 0},
+                                    {0, 0, 0, 0},
+                                    {0, 0, 0, 3}});
+  const auto images = AI::NTupleNetwork::symmetries(board);
+  EXPECT_EQ(images[0], board);
+
+  std::set<std::uint64_t> distinct;
+  for (Core::Bitboard image : images) {
+    distinct.insert(image.raw());
+    EXPECT_EQ(image.countEmpty(), board.countEmpty());
+  }
+  EXPECT_EQ(distinct.size(), 8u);
+  // Rotating the board permutes its images
+  for (Core::Bitboard image : AI::NTupleNetwork::symmetries(images[5]))
+    EXPECT_TRUE(distinct.count(image.raw()));
+}
+
+TEST(NTupleTest, ValueIsSymmetricAndLearnsTowardsTarget) {
+  AI::NTupleNetwork network(AI::NTupleNetwork::smallTuples());
+  const auto board = boardFromRows({{3, 1, 0, 0},
+                                    {0, 2, 0, 0},
+                                    {0, 0, 0, 0},
+                                    {1, 0, 0, 0}});
+  EXPECT_EQ(network.evaluate(board), 0.0f);
+
+  for (int i = 0; i < 50; ++i)
+    network.update(board, 0.1f * (100.0f - network.evaluate(board)) /
+                              network.featureCount());
+  EXPECT_NEAR(network.evaluate(board), 100.0f, 1.0f);
+  for (Core::Bitboard image : AI::NTupleNetwork::symmetries(board))
+    EXPECT_FLOAT_EQ(network.evaluate(image), network.evaluate(board));
+}
+
+TEST(NTupleTest, RejectsBadTuples) {
+  EXPECT_THROW(AI::NTupleNetwork(std::vector<AI::NTupleNetwork::Tuple>{}),
+               std::invalid_argument);
+  EXPECT_THROW(AI::NTupleNetwork({{0, 1, 2, 3, 4, 5, 6}}),
+               std::invalid_argument);
+  EXPECT_THROW(AI::NTupleNetwork({{0, 16}}), std::invalid_argument);
+}
+
+TEST(NTupleTest, SavedWeightsLoadMapped) {
+  AI::NTupleNetwork network(AI::NTupleNetwork::smallTuples());
+  for (std::uint64_t seed = 1; seed <= 20; ++seed)
+    AI::playTrainingGame(network, 0.1f, seed);
+
+  const std::string path = tempPath("ntuple_roundtrip.bin");
+  network.save(path);
+  const auto loaded = AI::NTupleNetwork::load(path);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->tuples(), network.tuples());
+  EXPECT_EQ(loaded->weightCount(), network.weightCount());
+
+  const auto board = boardFromRows({{5, 3, 1, 0},
+                                    {2, 0, 0, 0},
+                                    {1, 0, 0, 0},
+                                    {0, 0, 0, 0}});
+  EXPECT_NE(network.evaluate(board), 0.0f);
+  EXPECT_EQ(loaded->evaluate(board), network.evaluate(board));
+
+  // Training the loaded copy never writes through to the file
+  loaded->update(board, 1.0f);
+  EXPECT_EQ(AI::NTupleNetwork::load(path)->evaluate(board),
+            network.evaluate(board));
+  std::remove(path.c_str());
+}
+
+TEST(NTupleTest, LoadRejectsOtherFiles) {
+  const std::string path = tempPath("ntuple_garbage.bin");
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  std::fputs("definitely not weights", file);
+  std::fclose(file);
+
+  EXPECT_THROW(AI::NTupleNetwork::load(path), std::runtime_error);
+  EXPECT_THROW(AI::NTupleNetwork::load(tempPath("ntuple_missing.bin")),
+               std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(NTupleTest, TrainingImprovesTheGreedyPlayer) {
+  AI::NTupleNetwork network(AI::NTupleNetwork::smallTuples());
+  AI::NTupleStrategy player(network);
+  const auto before = AI::Simulator(player).run(1000, 20);
+
+  for (std::uint64_t seed = 1; seed <= 1500; ++seed)
+    AI::playTrainingGame(network, 0.1f, seed);
+  const auto after = AI::Simulator(player).run(1000, 20);
+
+  EXPECT_GT(after.meanScore(), before.meanScore() * 2);
+}
@@ -0,0 +1,95 @@
+#include "QuantizedNTuple.hpp"
+#include <bit>
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+// Small network after a few hundred training games
+const AI::NTupleNetwork &trainedNetwork() {
+  static const auto network = [] {
+    auto trained = std::make_unique<AI::NTupleNetwork>(
+        AI::NTupleNetwork::smallTuples());
+    for (std::uint64_t seed = 1; seed <= 300; ++seed)
+      AI::playTrainingGame(*trained, 0.1f, seed);
+    return trained;
+  }();
+  return *network;
+}
+
+// Positions from random play, restarting whenever a game ends
+std::vector<Core::Bitboard> sampleBoards() {
+  std::vector<Core::Bitboard> boards;
+  Core::Rng rng(5);
+  Core::GameLogic logic;
+  Core::Grid grid;
+  while (boards.size() < 500) {
+    grid.spawnRandomTile(rng);
+    const std::uint8_t legal = Core::GameLogic::legalMoves(grid);
+    if (legal == 0) {
+      grid = Core::Grid();
+      continue;
+    }
+    logic.moveFast(grid, AI::nthLegalMove(legal, rng.nextBelow(static_cast<std::uint32_t>(
+                                                     std::popcount(legal)))));
+    boards.push_back(Core::Bitboard::fromGrid(grid));
+  }
+  return boards;
+}
+
+// Worst case rounding: half a step per weight read
+float errorBound(const AI::QuantizedNTupleNetwork &quantized, std::size_t tuples) {
+  float bound = 0.0f;
+  for (std::size_t t = 0; t < tuples; ++t)
+    bound += AI::NTupleNetwork::SYMMETRIES * 0.5f * quantized.scale(t);
+  return bound * 1.001f + 1e-3f;
+}
+
+} // namespace
+
+TEST(QuantizedNTupleTest, ValuesStayWithinRoundingError) {
+  const auto &network = trainedNetwork();
+  for (auto precision : {AI::WeightPrecision::Int16, AI::WeightPrecision::Int8}) {
+    AI::QuantizedNTupleNetwork quantized(network, precision);
+    const float bound = errorBound(quantized, network.tuples().size());
+    for (Core::Bitboard board : sampleBoards()) {
+      EXPECT_NEAR(quantized.evaluate(Core::SimdLevel::Scalar, board),
+                  network.evaluate(board), bound);
+    }
+  }
+}
+
+TEST(QuantizedNTupleTest, Int8HalvesTheFootprint) {
+  const auto &network = trainedNetwork();
+  AI::QuantizedNTupleNetwork wide(network, AI::WeightPrecision::Int16);
+  AI::QuantizedNTupleNetwork narrow(network, AI::WeightPrecision::Int8);
+  EXPECT_EQ(wide.precision(), AI::WeightPrecision::Int16);
+  EXPECT_GE(wide.sizeBytes(), network.weightCount() * 2);
+  EXPECT_LT(narrow.sizeBytes(), wide.sizeBytes() / 2 + 16);
+}
+
+TEST(QuantizedNTupleTest, Avx2KernelMatchesScalar) {
+  if (!Core::BatchMove::isSupported(Core::SimdLevel::AVX2))
+    GTEST_SKIP() << "AVX2 not supported on this CPU";
+  const auto &network = trainedNetwork();
+  for (auto precision : {AI::WeightPrecision::Int16, AI::WeightPrecision::Int8}) {
+    AI::QuantizedNTupleNetwork quantized(network, precision);
+    for (Core::Bitboard board : sampleBoards()) {
+      const float scalar = quantized.evaluate(Core::SimdLevel::Scalar, board);
+      const float simd = quantized.evaluate(Core::SimdLevel::AVX2, board);
+      EXPECT_NEAR(simd, scalar, 1e-4f * (1.0f + std::fabs(scalar)));
+    }
+  }
+}
+
+TEST(QuantizedNTupleTest, QuantizedPlayerMatchesFloatPlayer) {
+  const auto &network = trainedNetwork();
+  AI::QuantizedNTupleNetwork quantized(network, AI::WeightPrecision::Int16);
+  AI::NTupleStrategy floatPlayer(network);
+  AI::NTupleStrategy intPlayer(quantized);
+
+  const auto expected = AI::Simulator(floatPlayer).run(50, 10);
+  const auto result = AI::Simulator(intPlayer).run(50, 10);
+  EXPECT_NEAR(result.meanScore(), expected.meanScore(),
+              0.25 * expected.meanScore());
+}
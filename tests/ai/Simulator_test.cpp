@@ -0,0 +1,73 @@
+#include "Simulator.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(SimulatorTest, SameSeedReplaysSameGame) {
+  AI::RandomStrategy strategy;
+  AI::Simulator simulator(strategy);
+
+  const auto a = simulator.playGame(42);
+  const auto b = simulator.playGame(42);
+  EXPECT_EQ(a.score, b.score);
+  EXPECT_EQ(a.moves, b.moves);
+  EXPECT_EQ(a.maxExponent, b.maxExponent);
+  EXPECT_GT(a.moves, 0);
+  EXPECT_GE(a.maxExponent, 3); // Any finished game has at least an 8
+}
+
+TEST(SimulatorTest, RunAggregatesEveryGame) {
+  AI::GreedyStrategy strategy;
+  AI::Simulator simulator(strategy);
+
+  const auto stats = simulator.run(100, 50);
+  EXPECT_EQ(stats.games, 50u);
+  ASSERT_EQ(stats.scores.size(), 50u);
+  EXPECT_EQ(std::accumulate(stats.maxTileCounts.begin(),
+                            stats.maxTileCounts.end(), std::uint64_t{0}),
+            50u);
+
+  // Game i of the run is the game with seed 100 + i
+  EXPECT_EQ(stats.scores[7], simulator.playGame(107).score);
+
+  EXPECT_LE(stats.scorePercentile(0), stats.scorePercentile(50));
+  EXPECT_LE(stats.scorePercentile(50), stats.scorePercentile(100));
+  EXPECT_GE(stats.meanScore(), stats.scorePercentile(0));
+}
+
+TEST(SimulatorTest, PercentilesUseNearestRank) {
+  AI::SimulationStats stats;
+  for (int score : {40, 10, 30, 20})
+    stats.add({0, score, 4, 1});
+
+  EXPECT_EQ(stats.scorePercentile(0), 10);
+  EXPECT_EQ(stats.scorePercentile(50), 20);
+  EXPECT_EQ(stats.scorePercentile(75), 30);
+  EXPECT_EQ(stats.scorePercentile(100), 40);
+  EXPECT_DOUBLE_EQ(stats.meanScore(), 25.0);
+
+  // Sorting for lookups leaves the recorded scores in seed order
+  const std::vector<int> sorted = stats.sortedScores();
+  EXPECT_EQ(sorted, (std::vector<int>{10, 20, 30, 40}));
+  EXPECT_EQ(AI::SimulationStats::scorePercentile(sorted, 75), 30);
+  EXPECT_EQ(stats.scores, (std::vector<int>{40, 10, 30, 20}));
+}
+
+namespace {
+// Always answers Up, legal or not
+class StubbornStrategy : public AI::Strategy {
+public:
+  Core::Direction chooseMove(const Core::Grid &, std::uint8_t,
+                             Core::Rng &) override {
+    return Core::Direction::Up;
+  }
+  std::string name() const override { return "stubborn"; }
+};
+} // namespace
+
+TEST(SimulatorTest, IllegalMoveIsReported) {
+  StubbornStrategy strategy;
+  AI::Simulator simulator(strategy);
+  EXPECT_THROW(simulator.playGame(1), std::logic_error);
+}
@@ -0,0 +1,59 @@
+#include "Strategy.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace {
+
+void setRow(Core::Grid &grid, int y, std::initializer_list<int> values) {
+  int x = 0;
+  for (int v : values)
+    grid.getTile(x++, y) = Core::Tile(v);
+}
+
+} // namespace
+
+TEST(StrategyTest, FactoryKnowsEveryListedName) {
+  for (const auto &name : AI::strategyNames()) {
+    auto strategy = AI::makeStrategy(name);
+    ASSERT_NE(strategy, nullptr);
+    EXPECT_EQ(strategy->name(), name);
+  }
+  EXPECT_THROW(AI::makeStrategy("minimax"), std::invalid_argument);
+}
+
+TEST(StrategyTest, NthLegalMoveWalksSetBits) {
+  const auto mask = static_cast<std::uint8_t>(
+      Core::GameLogic::directionBit(Core::Direction::Down) |
+      Core::GameLogic::directionBit(Core::Direction::Right));
+  EXPECT_EQ(AI::nthLegalMove(mask, 0), Core::Direction::Down);
+  EXPECT_EQ(AI::nthLegalMove(mask, 1), Core::Direction::Right);
+}
+
+TEST(StrategyTest, StrategiesOnlyPickLegalMoves) {
+  // Only Right and Down are legal for a lone corner tile
+  Core::Grid grid;
+  grid.getTile(0, 0) = Core::Tile(2);
+  const auto legal = Core::GameLogic::legalMoves(grid);
+  Core::Rng rng(3);
+
+  for (const auto &name : AI::strategyNames()) {
+    auto strategy = AI::makeStrategy(name);
+    for (int i = 0; i < 50; ++i) {
+      const auto dir = strategy->chooseMove(grid, legal, rng);
+      EXPECT_TRUE(legal & Core::GameLogic::directionBit(dir)) << name;
+    }
+  }
+}
+
+TEST(StrategyTest, GreedyTakesTheBiggestMerge) {
+  // Left/Right merge the 8s (16 points), Up/Down merge the 2s (4 points)
+  Core::Grid grid;
+  setRow(grid, 0, {8, 8, 2, 0});
+  setRow(grid, 1, {0, 0, 2, 0});
+  Core::Rng rng(1);
+  AI::GreedyStrategy greedy;
+
+  const auto dir =
+      greedy.chooseMove(grid, Core::GameLogic::legalMoves(grid), rng);
+  EXPECT_TRUE(dir == Core::Direction::Left || dir == Core::Direction::Right);
+}
@@ -0,0 +1,57 @@
+#include "Simulator.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, ParallelForCoversEveryIndexOnce) {
+  AI::ThreadPool pool(4);
+  std::vector<std::atomic<int>> hits(1000);
+
+  pool.parallelFor(hits.size(), 7,
+                   [&](std::uint64_t begin, std::uint64_t end, unsigned worker) {
+                     EXPECT_LT(worker, pool.size());
+                     for (std::uint64_t i = begin; i < end; ++i)
+                       hits[i].fetch_add(1);
+                   });
+
+  for (const auto &h : hits)
+    ASSERT_EQ(h.load(), 1);
+}
+
+TEST(ThreadPoolTest, WaitRethrowsTaskException) {
+  AI::ThreadPool pool(2);
+  pool.submit([](unsigned) { throw std::runtime_error("boom"); });
+  EXPECT_THROW(pool.wait(), std::runtime_error);
+
+  // The pool stays usable afterwards
+  std::atomic<int> ran{0};
+  pool.submit([&](unsigned) { ran.fetch_add(1); });
+  pool.wait();
+  EXPECT_EQ(ran.load(), 1);
+}
+
+TEST(ThreadPoolTest, WorkerStreamsAreDistinctAndSeeded) {
+  AI::ThreadPool a(3, 11);
+  AI::ThreadPool b(3, 11);
+  EXPECT_EQ(a.workerRng(2).next(), b.workerRng(2).next());
+  EXPECT_NE(a.workerRng(0).next(), a.workerRng(1).next());
+}
+
+TEST(ThreadPoolTest, SimulationIsIndependentOfThreadCount) {
+  AI::RandomStrategy strategy;
+  const auto expected = AI::Simulator(strategy).run(500, 300);
+  const AI::StrategyFactory factory = [] {
+    return std::make_unique<AI::RandomStrategy>();
+  };
+
+  for (unsigned threads : {1u, 2u, 5u}) {
+    AI::ThreadPool pool(threads);
+    const auto stats = AI::Simulator::runParallel(pool, factory, 500, 300);
+    EXPECT_EQ(stats.games, expected.games);
+    EXPECT_EQ(stats.moves, expected.moves);
+    EXPECT_EQ(stats.scores, expected.scores) << threads << " threads";
+    EXPECT_EQ(stats.maxTileCounts, expected.maxTileCounts);
+  }
+}
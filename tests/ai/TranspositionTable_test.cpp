@@ -0,0 +1,103 @@
+#include "Expectimax.hpp"
+#include "TranspositionTable.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(TranspositionTableTest, CapacityIsPowerOfTwoBuckets) {
+  AI::TranspositionTable table(1000);
+  EXPECT_EQ(table.capacity(), 512u); // 250 buckets -> 128 buckets of 4
+  EXPECT_EQ(table.sizeBytes(), 128u * 64u);
+}
+
+TEST(TranspositionTableTest, ProbeHonoursDepth) {
+  AI::TranspositionTable table(1024);
+  const Core::Bitboard board(0x1234);
+  float value = 0.0f;
+
+  EXPECT_FALSE(table.probe(board, 1, value));
+  table.store(board, 3, 42.5f);
+  EXPECT_TRUE(table.probe(board, 3, value));
+  EXPECT_FLOAT_EQ(value, 42.5f);
+  EXPECT_TRUE(table.probe(board, 2, value)); // Deeper result is reusable
+  EXPECT_FALSE(table.probe(board, 4, value));
+
+  // A shallower store does not replace a deeper one
+  table.store(board, 1, 7.0f);
+  EXPECT_TRUE(table.probe(board, 3, value));
+  EXPECT_FLOAT_EQ(value, 42.5f);
+
+  const auto stats = table.stats();
+  EXPECT_EQ(stats.hits, 3u);
+  EXPECT_EQ(stats.misses, 2u);
+}
+
+TEST(TranspositionTableTest, FullBucketEvictsShallowestAndCountsCollision) {
+  AI::TranspositionTable table(4); // One bucket: every board collides
+  for (int i = 0; i < 4; ++i)
+    table.store(Core::Bitboard(i + 1), i + 1, static_cast<float>(i));
+  EXPECT_EQ(table.stats().collisions, 0u);
+
+  table.store(Core::Bitboard(99), 5, 99.0f);
+  EXPECT_EQ(table.stats().collisions, 1u);
+
+  float value = 0.0f;
+  EXPECT_FALSE(table.probe(Core::Bitboard(1), 1, value)); // Depth 1 evicted
+  EXPECT_TRUE(table.probe(Core::Bitboard(4), 4, value));
+  EXPECT_TRUE(table.probe(Core::Bitboard(99), 5, value));
+}
+
+TEST(TranspositionTableTest, HugePageRequestStillWorks) {
+  // Falls back to normal pages when the OS has none to give
+  AI::TranspositionTable table(1 << 16, true);
+  table.store(Core::Bitboard(77), 2, 1.0f);
+  float value = 0.0f;
+  EXPECT_TRUE(table.probe(Core::Bitboard(77), 2, value));
+}
+
+TEST(TranspositionTableTest, ConcurrentWritersNeverYieldForeignValues) {
+  // Every board stores its own key as the value; a torn entry must never be
+  // returned for another board
+  AI::TranspositionTable table(256);
+  std::vector<std::thread> threads;
+  std::vector<int> bad(4, 0);
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&table, &bad, t] {
+      for (int i = 0; i < 20000; ++i) {
+        const auto key = static_cast<std::uint64_t>((i * 7 + t) % 1000 + 1);
+        table.store(Core::Bitboard(key), 1, static_cast<float>(key));
+        float value = 0.0f;
+        const auto probeKey = static_cast<std::uint64_t>((i * 13) % 1000 + 1);
+        if (table.probe(Core::Bitboard(probeKey), 1, value) &&
+            value != static_cast<float>(probeKey))
+          ++bad[t];
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  for (int b : bad)
+    EXPECT_EQ(b, 0);
+}
+
+TEST(TranspositionTableTest, ExpectimaxReusesPositions) {
+  Core::Bitboard board;
+  const int rows[4][4] = {{1, 2, 3, 4}, {0, 0, 2, 1}, {0, 1, 0, 0}, {2, 0, 0, 1}};
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      board.setExponent(x, y, rows[y][x]);
+
+  AI::ExpectimaxStrategy::Config config;
+  config.maxDepth = 3;
+  AI::ExpectimaxStrategy plain(config);
+  const auto uncached = plain.search(board);
+
+  AI::TranspositionTable table(1 << 16);
+  config.table = &table;
+  AI::ExpectimaxStrategy cached(config);
+  const auto result = cached.search(board);
+
+  EXPECT_GT(table.stats().hits, 0u);
+  EXPECT_LT(result.nodes, uncached.nodes);
+  EXPECT_EQ(result.move, uncached.move);
+}
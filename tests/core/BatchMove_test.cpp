@@ -0,0 +1,91 @@
+#include "BatchMove.hpp"
+#include "Bitboard.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr Core::Direction ALL_DIRECTIONS[] = {
+    Core::Direction::Up, Core::Direction::Down, Core::Direction::Left,
+    Core::Direction::Right};
+
+// Random packed boards, including empty rows and 15-exponent tiles
+std::vector<std::uint64_t> randomBoards(std::size_t count) {
+  std::mt19937_64 rng(8);
+  std::uniform_int_distribution<int> expDist(0, 15);
+  std::uniform_int_distribution<int> emptyDist(0, 2);
+
+  std::vector<std::uint64_t> boards(count);
+  for (auto &raw : boards) {
+    Core::Bitboard board;
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x) {
+        // Small exponents most of the time so that merges happen
+        int e = emptyDist(rng) == 0 ? 0 : expDist(rng);
+        board.setExponent(x, y, e > 6 && emptyDist(rng) ? e % 4 : e);
+      }
+    raw = board.raw();
+  }
+  return boards;
+}
+
+struct Outputs {
+  explicit Outputs(std::size_t n) : boards(n), scores(n), moved(n) {}
+  Core::BatchMoveOutput view() {
+    return {boards.data(), scores.data(), moved.data()};
+  }
+  std::vector<std::uint64_t> boards;
+  std::vector<std::uint32_t> scores;
+  std::vector<std::uint8_t> moved;
+};
+
+} // namespace
+
+TEST(BatchMoveTest, DetectedLevelIsSupported) {
+  EXPECT_TRUE(Core::BatchMove::isSupported(Core::BatchMove::detectedLevel()));
+  EXPECT_TRUE(Core::BatchMove::isSupported(Core::BatchMove::preferredLevel()));
+  EXPECT_TRUE(Core::BatchMove::isSupported(Core::SimdLevel::Scalar));
+}
+
+TEST(BatchMoveTest, EveryKernelMatchesBitboardMove) {
+  // Odd count exercises the scalar tail of the SIMD kernels
+  const auto boards = randomBoards(1027);
+
+  for (Core::SimdLevel level : {Core::SimdLevel::Scalar,
+                                Core::SimdLevel::SSE41,
+                                Core::SimdLevel::AVX2}) {
+    if (!Core::BatchMove::isSupported(level))
+      continue;
+    for (Core::Direction dir : ALL_DIRECTIONS) {
+      Outputs out(boards.size());
+      Core::BatchMove::apply(level, boards.data(), boards.size(), dir,
+                             out.view());
+
+      for (std::size_t i = 0; i < boards.size(); ++i) {
+        const auto expected = Core::Bitboard(boards[i]).move(dir);
+        ASSERT_EQ(out.boards[i], expected.board.raw())
+            << "level " << static_cast<int>(level) << " board " << i;
+        ASSERT_EQ(out.scores[i], static_cast<std::uint32_t>(expected.score));
+        ASSERT_EQ(out.moved[i] != 0, expected.moved);
+      }
+    }
+  }
+}
+
+TEST(BatchMoveTest, InPlaceAndTinyBatches) {
+  for (std::size_t n : {0u, 1u, 2u, 3u, 5u}) {
+    auto boards = randomBoards(n);
+    const auto original = boards;
+    std::vector<std::uint32_t> scores(n);
+    std::vector<std::uint8_t> moved(n);
+
+    Core::BatchMove::apply(boards.data(), n, Core::Direction::Down,
+                           {boards.data(), scores.data(), moved.data()});
+
+    for (std::size_t i = 0; i < n; ++i)
+      EXPECT_EQ(boards[i],
+                Core::Bitboard(original[i]).move(Core::Direction::Down)
+                    .board.raw());
+  }
+}
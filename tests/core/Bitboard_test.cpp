@@ -0,0 +1,184 @@
+#include "Bitboard.hpp"
+#include "GameLogic.hpp"
+#include "Grid.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+static_assert(sizeof(Core::Bitboard) == 8);
+static_assert(std::is_trivially_copyable_v<Core::Bitboard>);
+
+namespace {
+
+// Builds a board from row-major values (0 = empty)
+Core::Bitboard makeBoard(const std::array<int, 16> &values) {
+  Core::Grid grid;
+  for (int i = 0; i < 16; ++i)
+    grid.getTile(i % 4, i / 4) = Core::Tile(values[i]);
+  return Core::Bitboard::fromGrid(grid);
+}
+
+// Random board with small exponents so that merges are frequent
+Core::Grid randomGrid(std::mt19937 &rng) {
+  std::uniform_int_distribution<int> expDist(0, 4);
+  Core::Grid grid;
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x) {
+      int e = expDist(rng);
+      grid.getTile(x, y) = Core::Tile(e == 0 ? 0 : 1 << e);
+    }
+  return grid;
+}
+
+} // namespace
+
+TEST(BitboardTest, DefaultIsEmpty) {
+  Core::Bitboard board;
+  EXPECT_EQ(board.raw(), 0u);
+  EXPECT_EQ(board.countEmpty(), 16);
+  EXPECT_EQ(board.emptyMask(), 0xFFFF);
+}
+
+TEST(BitboardTest, CellLayoutIsRowMajorNibbles) {
+  Core::Bitboard board;
+  board.setExponent(1, 0, 3); // 8 at (1, 0) -> nibble 1
+  board.setExponent(0, 2, 5); // 32 at (0, 2) -> nibble 8
+  EXPECT_EQ(board.raw(), 0x0000000500000030ULL);
+  EXPECT_EQ(board.getValue(1, 0), 8);
+  EXPECT_EQ(board.getValue(0, 2), 32);
+  EXPECT_EQ(board.getRow(2), 0x0005);
+  EXPECT_EQ(board.getColumn(0), 0x0500);
+}
+
+TEST(BitboardTest, GridRoundTripIsLossless) {
+  Core::Grid grid;
+  grid.getTile(0, 0) = Core::Tile(2);
+  grid.getTile(3, 0) = Core::Tile(32768);
+  grid.getTile(2, 3) = Core::Tile(1024);
+
+  Core::Bitboard board = Core::Bitboard::fromGrid(grid);
+  EXPECT_EQ(board.maxExponent(), 15);
+  EXPECT_EQ(board.countEmpty(), 13);
+
+  Core::Grid restored;
+  board.toGrid(restored);
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      EXPECT_EQ(restored.getTile(x, y).getValue(),
+                grid.getTile(x, y).getValue());
+}
+
+TEST(BitboardTest, FromGridRejectsUnrepresentableValues) {
+  Core::Grid grid;
+  grid.getTile(0, 0) = Core::Tile(65536);
+  EXPECT_THROW((void)Core::Bitboard::fromGrid(grid), std::invalid_argument);
+
+  grid.getTile(0, 0) = Core::Tile(131072);
+  EXPECT_THROW((void)Core::Bitboard::fromGrid(grid), std::invalid_argument);
+}
+
+TEST(BitboardTest, TransposeSwapsRowsAndColumns) {
+  Core::Bitboard board(0xFEDCBA9876543210ULL);
+  Core::Bitboard t = board.transposed();
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      EXPECT_EQ(t.getExponent(x, y), board.getExponent(y, x));
+  EXPECT_EQ(t.transposed(), board);
+}
+
+TEST(BitboardTest, MoveLeftMergesOncePerPair) {
+  auto board = makeBoard({2, 2, 2, 2, //
+                          2, 0, 2, 2, //
+                          4, 4, 8, 0, //
+                          2, 4, 8, 16});
+  auto result = board.move(Core::Direction::Left);
+  EXPECT_TRUE(result.moved);
+  EXPECT_EQ(result.score, 4 + 4 + 4 + 8);
+  EXPECT_EQ(result.board, makeBoard({4, 4, 0, 0, //
+                                     4, 2, 0, 0, //
+                                     8, 8, 0, 0, //
+                                     2, 4, 8, 16}));
+}
+
+TEST(BitboardTest, MoveDownFollowsColumnOrder) {
+  auto board = makeBoard({2, 0, 0, 0, //
+                          0, 0, 0, 0, //
+                          2, 0, 0, 0, //
+                          2, 0, 0, 0});
+  auto result = board.move(Core::Direction::Down);
+  EXPECT_EQ(result.score, 4);
+  EXPECT_EQ(result.board, makeBoard({0, 0, 0, 0, //
+                                     0, 0, 0, 0, //
+                                     2, 0, 0, 0, //
+                                     4, 0, 0, 0}));
+}
+
+TEST(BitboardTest, MaxTilesDoNotMerge) {
+  Core::Bitboard board;
+  board.setExponent(0, 0, 15);
+  board.setExponent(1, 0, 15);
+  auto result = board.move(Core::Direction::Left);
+  EXPECT_FALSE(result.moved);
+  EXPECT_EQ(result.score, 0);
+}
+
+TEST(BitboardTest, MatchesGameLogicOnRandomBoards) {
+  std::mt19937 rng(1234);
+  Core::GameLogic logic;
+  for (int i = 0; i < 500; ++i) {
+    Core::Grid grid = randomGrid(rng);
+    for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                                Core::Direction::Left,
+                                Core::Direction::Right}) {
+      Core::Grid expected = grid;
+      auto logicResult = logic.move(expected, dir);
+      auto packed = Core::Bitboard::fromGrid(grid).move(dir);
+
+      ASSERT_EQ(packed.moved, logicResult.moved);
+      ASSERT_EQ(packed.score, logicResult.score);
+      ASSERT_EQ(packed.board, Core::Bitboard::fromGrid(expected));
+    }
+    EXPECT_EQ(Core::Bitboard::fromGrid(grid).isGameOver(),
+              logic.isGameOver(grid));
+  }
+}
+
+TEST(BitboardTest, GameOverOnCheckerboard) {
+  auto board = makeBoard({2, 4, 2, 4, //
+                          4, 2, 4, 2, //
+                          2, 4, 2, 4, //
+                          4, 2, 4, 2});
+  EXPECT_TRUE(board.isGameOver());
+  board.setExponent(3, 3, 2); // 4 next to 4 -> merge available
+  EXPECT_FALSE(board.isGameOver());
+}
+
+TEST(BitboardTest, LegalMovesMatchMoves) {
+  std::mt19937 rng(5);
+  std::uniform_int_distribution<int> expDist(0, 4);
+
+  for (int i = 0; i < 500; ++i) {
+    Core::Bitboard board;
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x)
+        board.setExponent(x, y, i % 10 == 0 ? 15 : expDist(rng));
+
+    const auto mask = board.legalMoves();
+    for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                                Core::Direction::Left,
+                                Core::Direction::Right}) {
+      ASSERT_EQ((mask & Core::GameLogic::directionBit(dir)) != 0,
+                board.move(dir).moved);
+    }
+  }
+}
+
+TEST(BitboardTest, HashSeparatesBoards) {
+  std::unordered_set<Core::Bitboard> seen;
+  for (std::uint64_t i = 0; i < 1000; ++i)
+    seen.insert(Core::Bitboard(i * 0x1111));
+  EXPECT_EQ(seen.size(), 1000u);
+  EXPECT_NE(Core::Bitboard(1).hash(), Core::Bitboard(2).hash());
+}
@@ -0,0 +1,110 @@
+#include "../AllocCounter.hpp"
+#include "Bitboard.hpp"
+#include "GameLogic.hpp"
+#include "Grid.hpp"
+#include <gtest/gtest.h>
+
+namespace {
+
+void fillBusyBoard(Core::Grid &grid) {
+  const int values[16] = {2, 2, 4, 8,  0,  4, 4,  0,
+                          8, 0, 8, 16, 32, 0, 32, 2};
+  for (int i = 0; i < 16; ++i)
+    grid.getTile(i % 4, i / 4) = Core::Tile(values[i]);
+}
+
+} // namespace
+
+TEST(GameLogicAllocTest, CounterSeesAllocations) {
+  // Guard against the replacement not being linked in (a direct call cannot
+  // be elided the way a new-expression can)
+  long n = countAllocations([] { ::operator delete(::operator new(16)); });
+  EXPECT_EQ(n, 1);
+}
+
+TEST(GameLogicAllocTest, BufferedMoveDoesNotAllocate) {
+  Core::Grid grid;
+  Core::GameLogic logic;
+  Core::GameLogic::MoveEventBuffer events;
+  logic.move(grid, Core::Direction::Left, events); // Warm up lookup tables
+
+  for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                              Core::Direction::Left, Core::Direction::Right}) {
+    fillBusyBoard(grid);
+    long n = countAllocations([&] {
+      auto result = logic.move(grid, dir, events);
+      EXPECT_TRUE(result.moved);
+    });
+    EXPECT_EQ(n, 0) << "direction " << static_cast<int>(dir);
+    EXPECT_FALSE(events.empty());
+  }
+}
+
+TEST(GameLogicAllocTest, FastMoveDoesNotAllocate) {
+  Core::Grid grid;
+  Core::GameLogic logic;
+  logic.moveFast(grid, Core::Direction::Left); // Warm up lookup tables
+
+  for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                              Core::Direction::Left, Core::Direction::Right}) {
+    fillBusyBoard(grid);
+    long n = countAllocations([&] { logic.moveFast(grid, dir); });
+    EXPECT_EQ(n, 0) << "direction " << static_cast<int>(dir);
+  }
+}
+
+TEST(GameLogicAllocTest, ReferenceRowPathDoesNotAllocate) {
+  // 32768 tiles bypass the tables and take slideAndMergeRow
+  Core::Grid grid;
+  grid.getTile(0, 0) = Core::Tile(32768);
+  grid.getTile(2, 0) = Core::Tile(32768);
+  Core::GameLogic logic;
+  Core::GameLogic::MoveEventBuffer events;
+
+  long n = countAllocations([&] {
+    auto result = logic.move(grid, Core::Direction::Left, events);
+    EXPECT_EQ(result.score, 65536);
+  });
+  EXPECT_EQ(n, 0);
+  EXPECT_EQ(events.size(), 2);
+}
+
+TEST(GameLogicAllocTest, SpawnDoesNotAllocate) {
+  Core::Rng rng(1);
+  Core::Grid grid;
+  long n = countAllocations([&] {
+    for (int i = 0; i < 17; ++i) // Last call hits the full board
+      grid.spawnRandomTile(rng);
+  });
+  EXPECT_EQ(n, 0);
+}
+
+TEST(GameLogicAllocTest, SpawnEnumerationDoesNotAllocate) {
+  const Core::Bitboard board(0x0000'1200'0300'0021ULL);
+  double total = 0.0;
+  long n = countAllocations([&] {
+    board.forEachSpawn(Core::SpawnDistribution::classic(),
+                       [&total](Core::Bitboard, double p) { total += p; });
+  });
+  EXPECT_EQ(n, 0);
+  EXPECT_NEAR(total, 1.0, 1e-12);
+}
+
+TEST(GameLogicAllocTest, BufferMatchesVectorOverload) {
+  Core::Grid a;
+  fillBusyBoard(a);
+  Core::Grid b = a;
+  Core::GameLogic logic;
+  Core::GameLogic::MoveEventBuffer events;
+
+  auto vectorResult = logic.move(a, Core::Direction::Right);
+  auto bufferResult = logic.move(b, Core::Direction::Right, events);
+
+  EXPECT_EQ(vectorResult.score, bufferResult.score);
+  ASSERT_EQ(static_cast<int>(vectorResult.events.size()), events.size());
+  for (int i = 0; i < events.size(); ++i) {
+    EXPECT_EQ(vectorResult.events[i].fromX, events[i].fromX);
+    EXPECT_EQ(vectorResult.events[i].toX, events[i].toX);
+    EXPECT_EQ(vectorResult.events[i].type, events[i].type);
+  }
+}
@@ -1,6 +1,7 @@
 #include "GameLogic.hpp"
 #include "Grid.hpp"
 #include <gtest/gtest.h>
+#include <random>
 
 // Helper to set a row for easy testing
 void setRow(Core::Grid &grid, int rowY, std::vector<int> values) {
@@ -297,3 +298,179 @@ TEST_F(GameLogicTest, GameOver_True) {
 
   EXPECT_TRUE(logic.isGameOver(grid));
 }
+
+TEST_F(GameLogicTest, Events_MergeAndSlide) {
+  // [2 2 2 0] Left -> two tiles merge into (0,0), third slides to (1,0)
+  setRow(grid, 0, {2, 2, 2, 0});
+
+  auto result = logic.move(grid, Core::Direction::Left);
+
+  using Type = Core::GameLogic::MoveEvent::Type;
+  ASSERT_EQ(result.events.size(), 3u);
+  EXPECT_EQ(result.events[0].type, Type::Merge);
+  EXPECT_EQ(result.events[0].fromX, 0);
+  EXPECT_EQ(result.events[0].toX, 0);
+  EXPECT_EQ(result.events[1].type, Type::Merge);
+  EXPECT_EQ(result.events[1].fromX, 1);
+  EXPECT_EQ(result.events[1].toX, 0);
+  EXPECT_EQ(result.events[1].value, 2);
+  EXPECT_EQ(result.events[1].mergedValue, 4);
+  EXPECT_EQ(result.events[2].type, Type::Slide);
+  EXPECT_EQ(result.events[2].fromX, 2);
+  EXPECT_EQ(result.events[2].toX, 1);
+}
+
+TEST_F(GameLogicTest, Events_DownMapsToColumns) {
+  // Col 2: [4, 0, 0, 0]T -> slides to the bottom
+  grid.getTile(2, 0) = Core::Tile(4);
+
+  auto result = logic.move(grid, Core::Direction::Down);
+
+  ASSERT_EQ(result.events.size(), 1u);
+  EXPECT_EQ(result.events[0].type, Core::GameLogic::MoveEvent::Type::Slide);
+  EXPECT_EQ(result.events[0].fromX, 2);
+  EXPECT_EQ(result.events[0].fromY, 0);
+  EXPECT_EQ(result.events[0].toX, 2);
+  EXPECT_EQ(result.events[0].toY, 3);
+  EXPECT_EQ(result.events[0].value, 4);
+}
+
+TEST_F(GameLogicTest, HugeTilesStillMerge) {
+  // 32768 + 32768 is outside the packed tables; the reference path handles it
+  setRow(grid, 0, {32768, 32768, 2, 0});
+
+  auto result = logic.move(grid, Core::Direction::Left);
+
+  EXPECT_TRUE(result.moved);
+  EXPECT_EQ(result.score, 65536);
+  checkRow(grid, 0, {65536, 2, 0, 0});
+  EXPECT_TRUE(grid.getTile(0, 0).hasMerged());
+}
+
+TEST_F(GameLogicTest, MoveFastMatchesEventMode) {
+  std::mt19937 rng(99);
+  std::uniform_int_distribution<int> expDist(0, 5);
+  Core::GameLogic::MoveEventBuffer events;
+
+  for (int i = 0; i < 200; ++i) {
+    Core::Grid start;
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x) {
+        int e = expDist(rng);
+        start.getTile(x, y) = Core::Tile(e == 0 ? 0 : 1 << e);
+      }
+
+    for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                                Core::Direction::Left,
+                                Core::Direction::Right}) {
+      Core::Grid a = start;
+      Core::Grid b = start;
+      auto full = logic.move(a, dir, events);
+      auto fast = logic.moveFast(b, dir);
+
+      ASSERT_EQ(full.moved, fast.moved);
+      ASSERT_EQ(full.score, fast.score);
+      for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 4; ++x) {
+          ASSERT_EQ(a.getTile(x, y).getValue(), b.getTile(x, y).getValue());
+          ASSERT_EQ(a.getTile(x, y).hasMerged(), b.getTile(x, y).hasMerged());
+        }
+    }
+  }
+}
+
+TEST_F(GameLogicTest, KernelsMatchTransformReference) {
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> expDist(0, 16); // Includes 32768+ tiles
+  std::uniform_int_distribution<int> emptyDist(0, 2);
+  Core::GameLogic::MoveEventBuffer events;
+
+  for (int i = 0; i < 500; ++i) {
+    Core::Grid start;
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x) {
+        // Mostly small tiles so that merges are frequent
+        int e = emptyDist(rng) == 0 ? 0 : expDist(rng) % (i % 5 == 0 ? 17 : 6);
+        start.getTile(x, y) = Core::Tile(e == 0 ? 0 : 1 << e);
+      }
+
+    for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                                Core::Direction::Left,
+                                Core::Direction::Right}) {
+      Core::Grid a = start;
+      Core::Grid b = start;
+      auto kernel = logic.move(a, dir, events);
+      auto reference = logic.moveReference(b, dir);
+
+      ASSERT_EQ(kernel.moved, reference.moved);
+      ASSERT_EQ(kernel.score, reference.score);
+      ASSERT_EQ(a.mergedMask(), b.mergedMask());
+      for (int y = 0; y < 4; ++y)
+        for (int x = 0; x < 4; ++x)
+          ASSERT_EQ(a.getExponent(x, y), b.getExponent(x, y));
+
+      ASSERT_EQ(events.size(), static_cast<int>(reference.events.size()));
+      for (int k = 0; k < events.size(); ++k) {
+        const auto &e1 = events[k];
+        const auto &e2 = reference.events[k];
+        ASSERT_EQ(e1.type, e2.type);
+        ASSERT_EQ(e1.fromX, e2.fromX);
+        ASSERT_EQ(e1.fromY, e2.fromY);
+        ASSERT_EQ(e1.toX, e2.toX);
+        ASSERT_EQ(e1.toY, e2.toY);
+        ASSERT_EQ(e1.value, e2.value);
+        ASSERT_EQ(e1.mergedValue, e2.mergedValue);
+      }
+    }
+  }
+}
+
+TEST_F(GameLogicTest, LegalMoves_SingleTileInCorner) {
+  // Top-left tile can only go right or down
+  grid.getTile(0, 0) = Core::Tile(2);
+  const auto mask = Core::GameLogic::legalMoves(grid);
+
+  EXPECT_EQ(mask, Core::GameLogic::directionBit(Core::Direction::Right) |
+                      Core::GameLogic::directionBit(Core::Direction::Down));
+}
+
+TEST_F(GameLogicTest, LegalMoves_FullBoardMergeOnly) {
+  setRow(grid, 0, {2, 2, 4, 8});
+  setRow(grid, 1, {16, 32, 64, 128});
+  setRow(grid, 2, {256, 512, 1024, 2048});
+  setRow(grid, 3, {2, 4, 8, 16});
+
+  EXPECT_EQ(Core::GameLogic::legalMoves(grid),
+            Core::GameLogic::directionBit(Core::Direction::Left) |
+                Core::GameLogic::directionBit(Core::Direction::Right));
+}
+
+TEST_F(GameLogicTest, LegalMovesMatchesMoveOnCopy) {
+  std::mt19937 rng(11);
+  std::uniform_int_distribution<int> expDist(0, 16);
+  std::uniform_int_distribution<int> emptyDist(0, 3);
+
+  for (int i = 0; i < 1000; ++i) {
+    Core::Grid start;
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x) {
+        // Dense boards with small tiles, so that both outcomes are common
+        int e = emptyDist(rng) == 0 ? 0 : expDist(rng) % (i % 7 == 0 ? 17 : 4);
+        start.getTile(x, y) = Core::Tile(e == 0 ? 0 : 1 << e);
+      }
+
+    const Core::Grid before = start;
+    const auto mask = Core::GameLogic::legalMoves(start);
+    for (Core::Direction dir : {Core::Direction::Up, Core::Direction::Down,
+                                Core::Direction::Left,
+                                Core::Direction::Right}) {
+      Core::Grid copy = start;
+      const bool legal = mask & Core::GameLogic::directionBit(dir);
+      ASSERT_EQ(legal, logic.moveFast(copy, dir).moved)
+          << "board " << i << " direction " << static_cast<int>(dir);
+    }
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x)
+        ASSERT_EQ(start.getExponent(x, y), before.getExponent(x, y));
+  }
+}
@@ -1,5 +1,7 @@
 #include "Grid.hpp"
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
 
 TEST(GridTest, InitializeEmpty) {
   Core::Grid grid;
@@ -59,3 +61,118 @@ TEST(GridTest, CantSpawnOnFullBoard) {
   // Board should be full now
   EXPECT_EQ(grid.spawnRandomTile().first, -1);
 }
+
+TEST(GridTest, IsSmallTriviallyCopyableValue) {
+  EXPECT_TRUE(std::is_trivially_copyable_v<Core::Grid>);
+  EXPECT_LE(sizeof(Core::Grid), 16 * sizeof(Core::Tile));
+}
+
+TEST(GridTest, EmptyMaskTracksCells) {
+  Core::Grid grid;
+  EXPECT_EQ(grid.emptyMask(), 0xFFFF);
+  grid.getTile(1, 0) = Core::Tile(2); // Cell 1
+  grid.getTile(3, 3) = Core::Tile(4); // Cell 15
+  EXPECT_EQ(grid.emptyMask(), 0xFFFF & ~(1 << 1) & ~(1 << 15));
+}
+
+TEST(GridTest, SeededSpawnsAreReproducible) {
+  Core::Rng rngA(123);
+  Core::Rng rngB(123);
+  Core::Grid a;
+  Core::Grid b;
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(a.spawnRandomTile(rngA), b.spawnRandomTile(rngB));
+  }
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      EXPECT_EQ(a.getTile(x, y).getValue(), b.getTile(x, y).getValue());
+}
+
+TEST(GridTest, SpawnOnlyUsesEmptyCells) {
+  Core::Rng rng(9);
+  Core::Grid grid;
+  for (int y = 0; y < 4; ++y)
+    for (int x = 0; x < 4; ++x)
+      if (!(x == 2 && y == 1))
+        grid.getTile(x, y) = Core::Tile(8);
+
+  auto [x, y] = grid.spawnRandomTile(rng);
+  EXPECT_EQ(x, 2);
+  EXPECT_EQ(y, 1);
+}
+
+TEST(GridTest, SpawnValueSplitIsNinetyTen) {
+  Core::Rng rng(2024);
+  int fours = 0;
+  const int trials = 20000;
+  for (int i = 0; i < trials; ++i) {
+    Core::Grid grid;
+    auto [x, y] = grid.spawnRandomTile(rng);
+    if (grid.getTile(x, y).getValue() == 4)
+      fours++;
+  }
+  EXPECT_NEAR(fours / static_cast<double>(trials), 0.1, 0.01);
+}
+
+TEST(GridTest, PackedLayoutIsEighteenBytes) {
+  EXPECT_EQ(sizeof(Core::Grid), 18u);
+}
+
+TEST(GridTest, TileRefKeepsTileApi) {
+  Core::Grid grid;
+  grid.getTile(2, 1) = Core::Tile(64);
+  grid.getTile(2, 1).setMerged(true);
+
+  EXPECT_EQ(grid.getTile(2, 1).getValue(), 64);
+  EXPECT_EQ(grid.getExponent(2, 1), 6);
+  EXPECT_TRUE(grid.getTile(2, 1).hasMerged());
+  EXPECT_EQ(grid.mergedMask(), 1 << (1 * 4 + 2));
+
+  // Copying out yields an independent Tile value
+  Core::Tile copy = grid.getTile(2, 1);
+  grid.getTile(2, 1).setValue(128);
+  grid.getTile(2, 1).resetMerged();
+  EXPECT_EQ(copy.getValue(), 64);
+  EXPECT_TRUE(copy.hasMerged());
+  EXPECT_EQ(grid.getTile(2, 1).getValue(), 128);
+  EXPECT_FALSE(grid.getTile(2, 1).hasMerged());
+
+  // Ref-to-ref assignment copies the cell, not the reference
+  grid.getTile(0, 0) = grid.getTile(2, 1);
+  EXPECT_EQ(grid.getTile(0, 0).getValue(), 128);
+  grid.getTile(0, 0).setValue(2);
+  EXPECT_EQ(grid.getTile(2, 1).getValue(), 128);
+
+  const Core::Grid &constGrid = grid;
+  EXPECT_EQ(constGrid.getTile(0, 0).getValue(), 2);
+}
+
+TEST(GridTest, TileRefRejectsValuesThatAreNotTiles) {
+  Core::Grid grid;
+  grid.getTile(1, 1) = Core::Tile(4);
+
+  for (int value : {1, 3, 6, 12, -2}) {
+    EXPECT_THROW(grid.getTile(1, 1).setValue(value), std::invalid_argument)
+        << value;
+    EXPECT_THROW(grid.getTile(1, 1) = Core::Tile(value), std::invalid_argument)
+        << value;
+  }
+  EXPECT_EQ(grid.getTile(1, 1).getValue(), 4);
+
+  grid.getTile(1, 1).setValue(0);
+  EXPECT_TRUE(grid.getTile(1, 1).isEmpty());
+}
+
+TEST(GridTest, SwapTilesMovesValueAndMergeFlag) {
+  Core::Grid grid;
+  grid.getTile(0, 0) = Core::Tile(8);
+  grid.getTile(0, 0).setMerged(true);
+  grid.getTile(3, 2) = Core::Tile(16);
+
+  grid.swapTiles(0, 0, 3, 2);
+
+  EXPECT_EQ(grid.getTile(0, 0).getValue(), 16);
+  EXPECT_FALSE(grid.getTile(0, 0).hasMerged());
+  EXPECT_EQ(grid.getTile(3, 2).getValue(), 8);
+  EXPECT_TRUE(grid.getTile(3, 2).hasMerged());
+}
@@ -0,0 +1,92 @@
+#include "MoveTables.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+// Independent slide-left on a vector of exponents (0 = empty)
+std::vector<int> slideLeft(const std::vector<int> &cells, int &score) {
+  std::vector<int> packed;
+  for (int e : cells)
+    if (e != 0)
+      packed.push_back(e);
+
+  std::vector<int> out;
+  for (size_t i = 0; i < packed.size(); ++i) {
+    if (i + 1 < packed.size() && packed[i] == packed[i + 1] &&
+        packed[i] < 15) {
+      out.push_back(packed[i] + 1);
+      score += 1 << (packed[i] + 1);
+      ++i;
+    } else {
+      out.push_back(packed[i]);
+    }
+  }
+  out.resize(4, 0);
+  return out;
+}
+
+std::vector<int> unpack(std::uint16_t row) {
+  std::vector<int> cells(4);
+  for (int i = 0; i < 4; ++i)
+    cells[i] = (row >> (4 * i)) & 0xF;
+  return cells;
+}
+
+} // namespace
+
+TEST(MoveTablesTest, LeftTableMatchesReferenceForAllRows) {
+  const auto &tables = Core::MoveTables::instance();
+  for (int r = 0; r < Core::MoveTables::ROW_COUNT; ++r) {
+    const auto row = static_cast<std::uint16_t>(r);
+    int score = 0;
+    auto expected = slideLeft(unpack(row), score);
+
+    const auto &entry = tables.left(row);
+    ASSERT_EQ(unpack(entry.row), expected) << "row " << std::hex << r;
+    ASSERT_EQ(entry.score, static_cast<std::uint32_t>(score));
+  }
+}
+
+TEST(MoveTablesTest, RightTableMirrorsLeftTable) {
+  const auto &tables = Core::MoveTables::instance();
+  for (int r = 0; r < Core::MoveTables::ROW_COUNT; ++r) {
+    const auto row = static_cast<std::uint16_t>(r);
+    const auto &mirrored = tables.left(Core::MoveTables::reverseRow(row));
+    const auto &entry = tables.right(row);
+    ASSERT_EQ(entry.row, Core::MoveTables::reverseRow(mirrored.row));
+    ASSERT_EQ(entry.score, mirrored.score);
+  }
+}
+
+TEST(MoveTablesTest, TargetsRebuildTheResultRow) {
+  // Every occupied source lands on its target; merged pairs share one
+  const auto &tables = Core::MoveTables::instance();
+  for (int r = 0; r < Core::MoveTables::ROW_COUNT; ++r) {
+    const auto row = static_cast<std::uint16_t>(r);
+    for (const auto *entry : {&tables.left(row), &tables.right(row)}) {
+      std::vector<int> rebuilt(4, 0);
+      for (int i = 0; i < 4; ++i) {
+        const int e = (row >> (4 * i)) & 0xF;
+        if (e == 0)
+          continue;
+        const int dest = entry->targetOf(i);
+        rebuilt[dest] = entry->mergedFrom(i) ? e + 1 : e;
+      }
+      ASSERT_EQ(rebuilt, unpack(entry->row)) << "row " << std::hex << r;
+    }
+  }
+}
+
+TEST(MoveTablesTest, MergePriorityAndTargets) {
+  // [2 2 2 0] -> [4 2 0 0]: cells 0 and 1 merge into 0, cell 2 slides to 1
+  const auto &entry = Core::MoveTables::instance().left(0x0111);
+  EXPECT_EQ(entry.row, 0x0012);
+  EXPECT_EQ(entry.score, 4u);
+  EXPECT_EQ(entry.targetOf(0), 0);
+  EXPECT_EQ(entry.targetOf(1), 0);
+  EXPECT_EQ(entry.targetOf(2), 1);
+  EXPECT_TRUE(entry.mergedFrom(0));
+  EXPECT_TRUE(entry.mergedFrom(1));
+  EXPECT_FALSE(entry.mergedFrom(2));
+}
@@ -0,0 +1,87 @@
+#include "Bitboard.hpp"
+#include "Grid.hpp"
+#include "SpawnDistribution.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<Core::SpawnDistribution>);
+
+TEST(SpawnDistributionTest, ClassicIsNinetyTen) {
+  const Core::SpawnDistribution &classic = Core::SpawnDistribution::classic();
+  ASSERT_EQ(classic.size(), 2);
+  EXPECT_EQ(classic.totalWeight(), 10u);
+  for (int i = 0; i < classic.size(); ++i) {
+    EXPECT_DOUBLE_EQ(classic.probability(i),
+                     classic.outcome(i).exponent == 1 ? 0.9 : 0.1);
+  }
+}
+
+TEST(SpawnDistributionTest, InvalidOutcomesThrow) {
+  EXPECT_THROW(Core::SpawnDistribution({}), std::invalid_argument);
+  EXPECT_THROW(Core::SpawnDistribution({{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}}),
+               std::invalid_argument);
+  EXPECT_THROW(Core::SpawnDistribution({{0, 1}}), std::invalid_argument);
+  EXPECT_THROW(Core::SpawnDistribution({{16, 1}}), std::invalid_argument);
+  EXPECT_THROW(Core::SpawnDistribution({{1, 0}}), std::invalid_argument);
+}
+
+TEST(SpawnDistributionTest, SamplingFollowsWeights) {
+  const Core::SpawnDistribution spawns{{1, 1}, {2, 2}, {3, 1}};
+  Core::Rng rng(11);
+  int counts[4] = {};
+  const int trials = 40000;
+  for (int i = 0; i < trials; ++i)
+    counts[spawns.sampleExponent(rng)]++;
+  EXPECT_NEAR(counts[1] / static_cast<double>(trials), 0.25, 0.01);
+  EXPECT_NEAR(counts[2] / static_cast<double>(trials), 0.50, 0.01);
+  EXPECT_NEAR(counts[3] / static_cast<double>(trials), 0.25, 0.01);
+}
+
+TEST(SpawnDistributionTest, EnumerationCoversEveryOutcome) {
+  // 3 empty cells: 0, 5 and 15
+  const Core::Bitboard board(0x0111'1111'1101'1110ULL);
+  int calls = 0;
+  double total = 0.0;
+  board.forEachSpawn(Core::SpawnDistribution::classic(),
+                     [&](Core::Bitboard next, double p) {
+                       ++calls;
+                       total += p;
+                       EXPECT_EQ(next.countEmpty(), 2);
+                       const bool four = next.maxExponent() == 2;
+                       EXPECT_NEAR(p, (four ? 0.1 : 0.9) / 3, 1e-12);
+                     });
+  EXPECT_EQ(calls, 6);
+  EXPECT_NEAR(total, 1.0, 1e-12);
+}
+
+TEST(SpawnDistributionTest, EnumerationSkipsFullBoard) {
+  const Core::Bitboard full(0x1212'2121'1212'2121ULL);
+  int calls = 0;
+  full.forEachSpawn(Core::SpawnDistribution::classic(),
+                    [&calls](Core::Bitboard, double) { ++calls; });
+  EXPECT_EQ(calls, 0);
+}
+
+TEST(SpawnDistributionTest, BitboardSpawnMatchesGrid) {
+  const Core::SpawnDistribution spawns{{1, 3}, {2, 2}, {3, 1}};
+  Core::Rng rngGrid(77);
+  Core::Rng rngBoard(77);
+  Core::Grid grid;
+  Core::Bitboard board;
+  for (int i = 0; i < 17; ++i) { // Last spawn hits the full board
+    grid.spawnRandomTile(rngGrid, spawns);
+    board = board.spawnRandom(rngBoard, spawns);
+    ASSERT_EQ(Core::Bitboard::fromGrid(grid), board) << "spawn " << i;
+  }
+}
+
+TEST(SpawnDistributionTest, GridUsesGivenDistribution) {
+  const Core::SpawnDistribution eights{{3, 1}};
+  Core::Rng rng(5);
+  Core::Grid grid;
+  for (int i = 0; i < 16; ++i) {
+    auto [x, y] = grid.spawnRandomTile(rng, eights);
+    EXPECT_EQ(grid.getTile(x, y).getValue(), 8);
+  }
+}
@@ -0,0 +1,98 @@
+#include "Symmetry.hpp"
+#include <gtest/gtest.h>
+#include <set>
+
+namespace {
+
+constexpr Core::Direction DIRECTIONS[] = {
+    Core::Direction::Up, Core::Direction::Down, Core::Direction::Left,
+    Core::Direction::Right};
+
+// Every cell different, so each symmetry gives a distinct image
+constexpr Core::Bitboard DISTINCT(0xFEDC'BA98'7654'3210ULL);
+
+Core::Symmetry symmetryAt(int s) { return static_cast<Core::Symmetry>(s); }
+
+} // namespace
+
+TEST(SymmetryTest, ImagesMatchTransform) {
+  const auto images = Core::symmetricImages(DISTINCT);
+  std::set<std::uint64_t> distinct;
+  for (int s = 0; s < Core::SYMMETRY_COUNT; ++s) {
+    EXPECT_EQ(images[s], Core::transform(DISTINCT, symmetryAt(s))) << s;
+    distinct.insert(images[s].raw());
+  }
+  EXPECT_EQ(distinct.size(), 8u);
+}
+
+TEST(SymmetryTest, NamedSymmetriesMoveCorners) {
+  Core::Bitboard board;
+  board.setExponent(0, 0, 5); // Top-left corner
+  const auto cornerOf = [&board](Core::Symmetry s) {
+    const Core::Bitboard image = Core::transform(board, s);
+    for (int y = 0; y < 4; ++y)
+      for (int x = 0; x < 4; ++x)
+        if (image.getExponent(x, y) == 5)
+          return std::pair{x, y};
+    return std::pair{-1, -1};
+  };
+  EXPECT_EQ(cornerOf(Core::Symmetry::Mirror), std::pair(3, 0));
+  EXPECT_EQ(cornerOf(Core::Symmetry::Flip), std::pair(0, 3));
+  EXPECT_EQ(cornerOf(Core::Symmetry::Rotate180), std::pair(3, 3));
+  EXPECT_EQ(cornerOf(Core::Symmetry::RotateClockwise), std::pair(3, 0));
+  EXPECT_EQ(cornerOf(Core::Symmetry::RotateCounterClockwise), std::pair(0, 3));
+  EXPECT_EQ(cornerOf(Core::Symmetry::AntiTranspose), std::pair(3, 3));
+}
+
+TEST(SymmetryTest, InverseUndoesTransform) {
+  for (int s = 0; s < Core::SYMMETRY_COUNT; ++s) {
+    const Core::Symmetry sym = symmetryAt(s);
+    EXPECT_EQ(Core::transform(Core::transform(DISTINCT, sym), Core::inverse(sym)),
+              DISTINCT)
+        << s;
+    for (Core::Direction dir : DIRECTIONS)
+      EXPECT_EQ(Core::transform(Core::transform(dir, sym), Core::inverse(sym)),
+                dir);
+  }
+}
+
+TEST(SymmetryTest, DirectionsCommuteWithTransform) {
+  // Mixed rows and columns so every direction merges differently
+  const Core::Bitboard board(0x1120'0301'2212'0111ULL);
+  for (int s = 0; s < Core::SYMMETRY_COUNT; ++s) {
+    const Core::Symmetry sym = symmetryAt(s);
+    for (Core::Direction dir : DIRECTIONS) {
+      const Core::BitboardMove original = board.move(dir);
+      const Core::BitboardMove image =
+          Core::transform(board, sym).move(Core::transform(dir, sym));
+      EXPECT_EQ(Core::transform(original.board, sym), image.board)
+          << "symmetry " << s << " direction " << static_cast<int>(dir);
+      EXPECT_EQ(original.score, image.score);
+    }
+  }
+}
+
+TEST(SymmetryTest, CanonicalFormIsSharedAndMinimal) {
+  const Core::CanonicalBoard canonical = Core::canonicalize(DISTINCT);
+  EXPECT_EQ(Core::transform(DISTINCT, canonical.symmetry), canonical.board);
+  for (Core::Bitboard image : Core::symmetricImages(DISTINCT)) {
+    EXPECT_LE(canonical.board.raw(), image.raw());
+    EXPECT_EQ(Core::canonicalize(image).board, canonical.board);
+  }
+}
+
+TEST(SymmetryTest, CanonicalMoveMapsBack) {
+  const Core::Bitboard board(0x0001'0012'0123'1234ULL);
+  const Core::CanonicalBoard canonical = Core::canonicalize(board);
+  const Core::Symmetry back = Core::inverse(canonical.symmetry);
+  for (Core::Direction dir : DIRECTIONS) {
+    const Core::Bitboard onCanonical = canonical.board.move(dir).board;
+    EXPECT_EQ(Core::transform(onCanonical, back),
+              board.move(Core::transform(dir, back)).board);
+  }
+}
+
+TEST(SymmetryTest, SymmetricBoardPicksLowestSymmetry) {
+  const Core::Bitboard empty;
+  EXPECT_EQ(Core::canonicalize(empty).symmetry, Core::Symmetry::Identity);
+}
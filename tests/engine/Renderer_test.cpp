@@ -0,0 +1,58 @@
+#include "Context.hpp"
+#include "Renderer.hpp"
+#include "Texture.hpp"
+#include "Window.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+
+const std::string TILE_PATH =
+    std::string(TILETWISTER_ASSETS_DIR) + "/tile_rounded.png";
+
+// Headless SDL: no display needed, software rendering
+class RendererStatsTest : public ::testing::Test {
+protected:
+  static void SetUpTestSuite() {
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  }
+
+  Engine::Context context;
+  Engine::Window window{"Renderer Test", 64, 64};
+  Engine::Renderer renderer{window, 64, 64};
+};
+
+} // namespace
+
+TEST_F(RendererStatsTest, TextureDestroyedAfterResetIsCountedInItsFrame) {
+  auto texture = std::make_unique<Engine::Texture>(renderer, TILE_PATH);
+  renderer.present(); // Publishes the frame and resets the counters
+  EXPECT_EQ(renderer.getFrameStats().texturesCreated, 1);
+  EXPECT_EQ(renderer.getFrameStats().texturesDestroyed, 0);
+
+  texture.reset();
+  renderer.present();
+  EXPECT_EQ(renderer.getFrameStats().texturesCreated, 0);
+  EXPECT_EQ(renderer.getFrameStats().texturesDestroyed, 1);
+}
+
+TEST_F(RendererStatsTest, CountsDrawsBindsAndStateChanges) {
+  Engine::Texture texture(renderer, TILE_PATH);
+  renderer.present();
+
+  const SDL_Rect rect = {0, 0, 16, 16};
+  texture.setColor(10, 20, 30);
+  renderer.drawTexture(texture, rect);
+  renderer.drawTexture(texture, rect); // Same texture: no new bind
+  renderer.drawFillRect(0, 0, 8, 8);
+  for (int i = 0; i < 4; ++i) // One batched submission
+    renderer.batchSprite(texture, rect, 255, 255, 255);
+  renderer.present();
+
+  const Engine::FrameStats &stats = renderer.getFrameStats();
+  EXPECT_EQ(stats.drawCalls, 4);
+  EXPECT_EQ(stats.textureBinds, 2); // Re-bound after the untextured fill
+  EXPECT_EQ(stats.stateChanges, 1);
+  EXPECT_EQ(stats.textRasterizations, 0);
+}